@@ -438,6 +438,7 @@ void DestroyContext(ImPlotContext* ctx) {
         ctx = GImPlot;
     if (GImPlot == ctx)
         SetCurrentContext(nullptr);
+    ReleaseHeatmapTextures(ctx);
     IM_DELETE(ctx);
 }
 
@@ -457,6 +458,13 @@ void Initialize(ImPlotContext* ctx) {
     ResetCtxForNextAlignedPlots(ctx);
     ResetCtxForNextSubplot(ctx);
 
+    ctx->TaskRunner     = nullptr;
+    ctx->TaskRunnerData = nullptr;
+    ctx->TaskMinPrims   = 100000;
+
+    ctx->HeatmapTexCallback     = nullptr;
+    ctx->HeatmapTexCallbackData = nullptr;
+
     const ImU32 Deep[]     = {4289753676, 4283598045, 4285048917, 4283584196, 4289950337, 4284512403, 4291005402, 4287401100, 4285839820, 4291671396                        };
     const ImU32 Dark[]     = {4280031972, 4290281015, 4283084621, 4288892568, 4278222847, 4281597951, 4280833702, 4290740727, 4288256409                                    };
     const ImU32 Pastel[]   = {4289639675, 4293119411, 4291161036, 4293184478, 4289124862, 4291624959, 4290631909, 4293712637, 4294111986                                    };
@@ -521,6 +529,22 @@ void ResetCtxForNextSubplot(ImPlotContext* ctx) {
     ctx->CurrentAlignmentV   = nullptr;
 }
 
+void ReleaseHeatmapTextures(ImPlotContext* ctx, ImPlotItemGroup& items) {
+    for (int i = 0; i < items.GetItemCount(); ++i) {
+        ImPlotItem& item = *items.GetItemByIndex(i);
+        if (item.TexID != 0 && ctx->HeatmapTexCallback != nullptr)
+            ctx->HeatmapTexCallback(nullptr, 0, 0, item.TexID, ctx->HeatmapTexCallbackData);
+        item.TexID = 0;
+    }
+}
+
+void ReleaseHeatmapTextures(ImPlotContext* ctx) {
+    for (int p = 0; p < ctx->Plots.GetBufSize(); ++p)
+        ReleaseHeatmapTextures(ctx, ctx->Plots.GetByIndex(p)->Items);
+    for (int p = 0; p < ctx->Subplots.GetBufSize(); ++p)
+        ReleaseHeatmapTextures(ctx, ctx->Subplots.GetByIndex(p)->Items);
+}
+
 //-----------------------------------------------------------------------------
 // Plot Utils
 //-----------------------------------------------------------------------------
@@ -537,6 +561,7 @@ ImPlotPlot* GetCurrentPlot() {
 
 void BustPlotCache() {
     ImPlotContext& gp = *GImPlot;
+    ReleaseHeatmapTextures(&gp);
     gp.Plots.Clear();
     gp.Subplots.Clear();
 }
@@ -3792,6 +3817,16 @@ void HideNextItem(bool hidden, ImPlotCond cond) {
     gp.NextItemData.HiddenCond = cond;
 }
 
+void DownsampleNextItem(int max_points) {
+    ImPlotContext& gp = *GImPlot;
+    gp.NextItemData.DownsamplePoints = max_points < 0 ? IMPLOT_AUTO : ImMax(max_points, 3);
+}
+
+void SetNextItemDataVersion(int version) {
+    ImPlotContext& gp = *GImPlot;
+    gp.NextItemData.DataVersion = version;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Tools
 //-----------------------------------------------------------------------------
@@ -4862,6 +4897,28 @@ void PopPlotClipRect() {
     ImGui::PopClipRect();
 }
 
+void SetTaskRunner(ImPlotTaskRunner runner, void* user_data, int min_prims) {
+    ImPlotContext& gp = *GImPlot;
+    gp.TaskRunner     = runner;
+    gp.TaskRunnerData = user_data;
+    gp.TaskMinPrims   = ImMax(min_prims, 1);
+}
+
+void SetMarkerAtlas(ImPlotTextureCallback callback, void* user_data) {
+    ImPlotContext& gp = *GImPlot;
+    gp.MarkerAtlas.Clear();
+    gp.MarkerAtlas.Callback     = callback;
+    gp.MarkerAtlas.CallbackData = user_data;
+}
+
+void SetHeatmapTextures(ImPlotTextureCallback callback, void* user_data) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.HeatmapTexCallback != callback || gp.HeatmapTexCallbackData != user_data)
+        ReleaseHeatmapTextures(&gp);
+    gp.HeatmapTexCallback     = callback;
+    gp.HeatmapTexCallbackData = user_data;
+}
+
 static void HelpMarker(const char* desc) {
     ImGui::TextDisabled("(?)");
     if (ImGui::IsItemHovered()) {
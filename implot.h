@@ -223,6 +223,7 @@ enum ImPlotItemFlags_ {
     ImPlotItemFlags_None     = 0,
     ImPlotItemFlags_NoLegend = 1 << 0, // the item won't have a legend entry displayed
     ImPlotItemFlags_NoFit    = 1 << 1, // the item won't be considered for plot fits
+    ImPlotItemFlags_SortedX  = 1 << 2, // the item's x values are increasing, so only the visible range will be processed (PlotLine, PlotScatter, PlotStairs, PlotShaded, and PlotDigital)
 };
 
 // Flags for PlotLine
@@ -233,12 +234,14 @@ enum ImPlotLineFlags_ {
     ImPlotLineFlags_SkipNaN     = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
     ImPlotLineFlags_NoClip      = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
     ImPlotLineFlags_Shaded      = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_Decimate    = 1 << 15, // lines and fills will be reduced to the first, min, max, and last points of each pixel column before rendering (best suited for dense data with increasing x values)
 };
 
 // Flags for PlotScatter
 enum ImPlotScatterFlags_ {
-    ImPlotScatterFlags_None   = 0,       // default
-    ImPlotScatterFlags_NoClip = 1 << 10, // markers on the edge of a plot will not be clipped
+    ImPlotScatterFlags_None    = 0,       // default
+    ImPlotScatterFlags_NoClip  = 1 << 10, // markers on the edge of a plot will not be clipped
+    ImPlotScatterFlags_Density = 1 << 11, // points will be binned into cells of the plot area and drawn as a colormapped density raster instead of markers (best suited for very large point counts)
 };
 
 // Flags for PlotStairs
@@ -503,6 +506,21 @@ struct ImPlotRect {
     ImPlotPoint Max() const                                                      { return ImPlotPoint(X.Max, Y.Max);          }
 };
 
+// Histogram counts accumulated incrementally, so that only new values need to be binned each frame (see AddHistogramValues).
+// Bins either span a fixed range, or have a power of two width that doubles whenever a value falls outside of them.
+struct ImPlotHistogramState {
+    ImVector<double> Counts;       // count of each bin
+    double           Min;          // lower edge of the first bin
+    double           Width;        // bin width (0 until an auto ranging histogram gets its first finite value)
+    bool             AutoRange;    // widen bins to fit new values instead of counting them as outliers
+    double           Below, Above; // values outside of the bins (NaNs count as above)
+    double           Total;        // values added, including outliers
+    explicit ImPlotHistogramState(int bins = 64)              : Min(0), Width(0),                           AutoRange(true)  { IM_ASSERT(bins > 0); Counts.resize(bins); Reset(); }
+    ImPlotHistogramState(int bins, const ImPlotRange& range)  : Min(range.Min), Width(range.Size() / bins), AutoRange(false) { IM_ASSERT(bins > 0); Counts.resize(bins); Reset(); }
+    void   Reset()     { for (int b = 0; b < Counts.Size; ++b) Counts[b] = 0; Below = Above = Total = 0; if (AutoRange) Min = Width = 0; }
+    double Max() const { return Min + Counts.Size * Width; }
+};
+
 // Plot style structure
 struct ImPlotStyle {
     // item styling variables
@@ -590,6 +608,21 @@ typedef ImPlotPoint (*ImPlotGetter)(int idx, void* user_data);
 // Callback signature for axis transform.
 typedef double (*ImPlotTransform)(double value, void* user_data);
 
+// Callback signature for creating or updating a texture from RGBA32 pixels (see SetMarkerAtlas). #tex_id is the id
+// previously returned (0 the first time). Returns the id of the texture holding the pixels. Textures can be
+// updated after being drawn earlier in the frame, so a non-zero #tex_id should be updated in place and returned.
+// When a texture is no longer used, the callback is called once with #pixels == nullptr and its #tex_id so that the
+// application can release it (the return value is ignored). It may still be used by this frame's draw data, so
+// destroying it should wait until that has been rendered.
+typedef ImTextureID (*ImPlotTextureCallback)(const unsigned char* pixels, int width, int height, ImTextureID tex_id, void* user_data);
+
+// Callback signature for a unit of parallel work (see SetTaskRunner).
+typedef void (*ImPlotTask)(int task_idx, void* task_data);
+
+// Callback signature for a task runner. Must call task(i, task_data) for every i in [0,task_count), possibly
+// concurrently, and only return once all of them have finished.
+typedef void (*ImPlotTaskRunner)(ImPlotTask task, void* task_data, int task_count, void* user_data);
+
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -903,11 +936,18 @@ IMPLOT_TMP void PlotHeatmap(const char* label_id, const T* values, int rows, int
 // Otherwise, outlier values outside of the range are not binned. The largest bin count or density is returned.
 IMPLOT_TMP double PlotHistogram(const char* label_id, const T* values, int count, int bins=ImPlotBin_Sturges, double bar_scale=1.0, ImPlotRange range=ImPlotRange(), ImPlotHistogramFlags flags=0);
 
+// Adds #count values to an incremental histogram. Pass only the values appended since the last call.
+IMPLOT_TMP void AddHistogramValues(ImPlotHistogramState& state, const T* values, int count);
+// Plots an incremental histogram with the same bars and flags as PlotHistogram. The largest bin count or density is returned.
+IMPLOT_API double PlotHistogram(const char* label_id, const ImPlotHistogramState& state, double bar_scale=1.0, ImPlotHistogramFlags flags=0);
+
 // Plots two dimensional, bivariate histogram as a heatmap. #x_bins and #y_bins can be a positive integer or an ImPlotBin. If #range is left unspecified, the min/max of
 // #xs an #ys will be used as the ranges. Otherwise, outlier values outside of range are not binned. The largest bin count or density is returned.
 IMPLOT_TMP double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins=ImPlotBin_Sturges, int y_bins=ImPlotBin_Sturges, ImPlotRect range=ImPlotRect(), ImPlotHistogramFlags flags=0);
 
 // Plots digital data. Digital plots do not respond to y drag or zoom, and are always referenced to the bottom of the plot.
+// An item is as tall as its highest state, which is found by scanning all #count points every frame unless the item
+// has a data version (see SetNextItemDataVersion). Large channels should set one.
 IMPLOT_TMP void PlotDigital(const char* label_id, const T* xs, const T* ys, int count, ImPlotDigitalFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotDigitalG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotDigitalFlags flags=0);
 
@@ -998,6 +1038,19 @@ IMPLOT_API void CancelPlotSelection();
 // Use ImPlotCond_Always if you need to forcefully set this every frame.
 IMPLOT_API void HideNextItem(bool hidden = true, ImPlotCond cond = ImPlotCond_Once);
 
+// Downsamples the next line, scatter, or stairs item to about #max_points over the visible x range
+// with Largest-Triangle-Three-Buckets (LTTB). The item's x values must be increasing. Passing
+// IMPLOT_AUTO uses the plot's width in pixels. Fitting still considers every point. Ignored for ImPlotLineFlags_Segments.
+IMPLOT_API void DownsampleNextItem(int max_points = IMPLOT_AUTO);
+
+// Retains the vertices generated for the next item. #version must change whenever the values the item's data points
+// to do; the other plot arguments (data pointers, counts, strides, xscale, yref, etc.) are tracked automatically, and
+// while those and the plot's axes stay the same, later frames copy the retained geometry instead of rebuilding
+// it. Downsampled points (see DownsampleNextItem and ImPlotLineFlags_Decimate) are kept while the view stays the
+// same, and fit extents are kept so that auto-fitting doesn't rescan the item's data (unless an axis uses
+// ImPlotAxisFlags_RangeFit). Passing 0 disables retention and releases the memory (default).
+IMPLOT_API void SetNextItemDataVersion(int version);
+
 // Use the following around calls to Begin/EndPlot to align l/r/t/b padding.
 // Consider using Begin/EndSubplots first. They are more feature rich and
 // accomplish the same behaviour by default. The functions below offer lower
@@ -1225,6 +1278,22 @@ IMPLOT_API void PushPlotClipRect(float expand=0);
 // Pop plot clip rect. Call between Begin/EndPlot.
 IMPLOT_API void PopPlotClipRect();
 
+// Sets a task runner used to split vertex generation of items with at least #min_prims primitives across threads.
+// Pass nullptr to disable (default). Note that ImPlotGetter and ImPlotTransform callbacks may then be called concurrently.
+IMPLOT_API void SetTaskRunner(ImPlotTaskRunner runner, void* user_data = nullptr, int min_prims = 100000);
+
+// Rasterizes each marker shape, size, and weight once into 512x512 atlas textures (added as they fill up) and renders
+// markers as one textured quad each. #callback creates or updates a texture whenever sprites are added to it. The
+// previous callback releases the atlas textures when this is called again or the context is destroyed. Pass nullptr
+// to disable (default).
+IMPLOT_API void SetMarkerAtlas(ImPlotTextureCallback callback, void* user_data = nullptr);
+
+// Renders heatmaps on linear axes as one textured quad each instead of a rect per cell. #callback creates or updates
+// an item's texture when its values (see SetNextItemDataVersion), scale, or colormap change. Textures should be sampled
+// with nearest filtering. #callback releases them when items are evicted (see BustColorCache), when the callback
+// changes, or when the context is destroyed. Pass nullptr to disable (default).
+IMPLOT_API void SetHeatmapTextures(ImPlotTextureCallback callback, void* user_data = nullptr);
+
 // Shows ImPlot style selector dropdown menu.
 IMPLOT_API bool ShowStyleSelector(const char* label);
 // Shows ImPlot colormap selector dropdown menu.
@@ -1051,15 +1051,9 @@ void Demo_TimeScale() {
         ImPlot::SetupAxisScale(ImAxis_X1, ImPlotScale_Time);
         ImPlot::SetupAxesLimits(t_min,t_max,0,1);
         if (data != nullptr) {
-            // downsample our data
-            int downsample = (int)ImPlot::GetPlotLimits().X.Size() / 1000 + 1;
-            int start = (int)(ImPlot::GetPlotLimits().X.Min - t_min);
-            start = start < 0 ? 0 : start > HugeTimeData::Size - 1 ? HugeTimeData::Size - 1 : start;
-            int end = (int)(ImPlot::GetPlotLimits().X.Max - t_min) + 1000;
-            end = end < 0 ? 0 : end > HugeTimeData::Size - 1 ? HugeTimeData::Size - 1 : end;
-            int size = (end - start)/downsample;
-            // plot it
-            ImPlot::PlotLine("Time Series", &data->Ts[start], &data->Ys[start], size, 0, 0, sizeof(double)*downsample);
+            // downsample the visible range of our data to about one point per pixel (LTTB)
+            ImPlot::DownsampleNextItem();
+            ImPlot::PlotLine("Time Series", data->Ts, data->Ys, HugeTimeData::Size);
         }
         // plot time now
         double t_now = (double)time(nullptr);
@@ -133,49 +133,36 @@ static inline double ImConstrainLog(double val) { return val <= 0 ? 0.001f : val
 static inline double ImConstrainTime(double val) { return val < IMPLOT_MIN_TIME ? IMPLOT_MIN_TIME : (val > IMPLOT_MAX_TIME ? IMPLOT_MAX_TIME : val); }
 // True if two numbers are approximately equal using units in the last place.
 static inline bool ImAlmostEqual(double v1, double v2, int ulp = 2) { return ImAbs(v1-v2) < DBL_EPSILON * ImAbs(v1+v2) * ulp || ImAbs(v1-v2) < DBL_MIN; }
+// The reductions below ignore NaNs and are vectorized, and split across tasks for large counts (see SetTaskRunner).
+// They are instantiated for the types in IMPLOT_NUMERIC_TYPES, and always available for float and double through the
+// overloads at the end of this group, which ImPlot itself uses.
+// Finds the min and max value in an unsorted array (both are NaN if every value is)
+template <typename T>
+IMPLOT_API void ImMinMaxArray(const T* values, int count, T* min_out, T* max_out);
 // Finds min value in an unsorted array
 template <typename T>
-static inline T ImMinArray(const T* values, int count) { T m = values[0]; for (int i = 1; i < count; ++i) { if (values[i] < m) { m = values[i]; } } return m; }
+static inline T ImMinArray(const T* values, int count) { T m, n; ImMinMaxArray(values, count, &m, &n); return m; }
 // Finds the max value in an unsorted array
 template <typename T>
-static inline T ImMaxArray(const T* values, int count) { T m = values[0]; for (int i = 1; i < count; ++i) { if (values[i] > m) { m = values[i]; } } return m; }
-// Finds the min and max value in an unsorted array
-template <typename T>
-static inline void ImMinMaxArray(const T* values, int count, T* min_out, T* max_out) {
-    T Min = values[0]; T Max = values[0];
-    for (int i = 1; i < count; ++i) {
-        if (values[i] < Min) { Min = values[i]; }
-        if (values[i] > Max) { Max = values[i]; }
-    }
-    *min_out = Min; *max_out = Max;
-}
-// Finds the sim of an array
+static inline T ImMaxArray(const T* values, int count) { T m, n; ImMinMaxArray(values, count, &m, &n); return n; }
+// Finds the sum of an array
 template <typename T>
-static inline T ImSum(const T* values, int count) {
-    T sum  = 0;
-    for (int i = 0; i < count; ++i)
-        sum += values[i];
-    return sum;
-}
-// Finds the mean of an array
+IMPLOT_API T ImSum(const T* values, int count);
+// Finds the mean of an array (NaN if it has no values)
 template <typename T>
-static inline double ImMean(const T* values, int count) {
-    double den = 1.0 / count;
-    double mu  = 0;
-    for (int i = 0; i < count; ++i)
-        mu += (double)values[i] * den;
-    return mu;
-}
-// Finds the sample standard deviation of an array
+IMPLOT_API double ImMean(const T* values, int count);
+// Finds the sample standard deviation of an array (NaN if it has less than two values)
 template <typename T>
-static inline double ImStdDev(const T* values, int count) {
-    double den = 1.0 / (count - 1.0);
-    double mu  = ImMean(values, count);
-    double x   = 0;
-    for (int i = 0; i < count; ++i)
-        x += ((double)values[i] - mu) * ((double)values[i] - mu) * den;
-    return sqrt(x);
-}
+IMPLOT_API double ImStdDev(const T* values, int count);
+// Overloads of the above for float and double, whatever IMPLOT_NUMERIC_TYPES is
+IMPLOT_API void   ImMinMaxArray(const float* values, int count, float* min_out, float* max_out);
+IMPLOT_API void   ImMinMaxArray(const double* values, int count, double* min_out, double* max_out);
+IMPLOT_API float  ImSum(const float* values, int count);
+IMPLOT_API double ImSum(const double* values, int count);
+IMPLOT_API double ImMean(const float* values, int count);
+IMPLOT_API double ImMean(const double* values, int count);
+IMPLOT_API double ImStdDev(const float* values, int count);
+IMPLOT_API double ImStdDev(const double* values, int count);
 // Mix color a and b by factor s in [0 256]
 static inline ImU32 ImMixU32(ImU32 a, ImU32 b, ImU32 s) {
 #ifdef IMPLOT_MIX64
@@ -420,6 +407,7 @@ struct ImPlotColormapData {
 // ImPlotPoint with positive/negative error values
 struct ImPlotPointError {
     double X, Y, Neg, Pos;
+    ImPlotPointError() { X = Y = Neg = Pos = 0.0; }
     ImPlotPointError(double x, double y, double neg, double pos) {
         X = x; Y = y; Neg = neg; Pos = pos;
     }
@@ -936,6 +924,83 @@ struct ImPlotAlignmentData {
     void Reset() { PadA = PadB = PadAMax = PadBMax = 0; }
 };
 
+// Range of retained geometry whose indices share one vertex offset (i.e. one ImDrawCmd)
+struct ImPlotGeometryRun
+{
+    int VtxOffset, VtxCount;
+    int IdxOffset, IdxCount;
+};
+
+// Geometry generated by one RenderPrimitives call of an item, retained for reuse in later frames
+struct ImPlotGeometryCache
+{
+    ImGuiID                     Key;    // hash of the renderer, its arguments, data version, cull rect, draw list state, and nonlinear transforms
+    ImPlotPoint                 PltMin; // x/y axis Range.Min when generated
+    ImPlotPoint                 PltMax; // x/y axis Range.Max when generated
+    ImPlotPoint                 Scale;  // x/y axis ScaleToPixel when generated
+    ImVec2                      Drift;  // pixels the geometry has been translated by since it was last fully generated
+    ImVector<ImDrawVert>        Vtx;
+    ImVector<ImDrawIdx>         Idx;    // relative to the first vertex of their run
+    ImVector<ImPlotGeometryRun> Runs;
+
+    ImPlotGeometryCache() { Key = 0; Drift = ImVec2(0,0); }
+};
+
+// Points a downsampler produced for an item, kept while its data version and the plot's view stay the same
+struct ImPlotPointCache
+{
+    ImGuiID               Key;    // hash of the downsampler, its source count, data version, and the plot's view
+    ImVector<ImPlotPoint> Points;
+
+    ImPlotPointCache() { Key = 0; }
+};
+
+// Extents found for one plot call of an item, kept while its data version (and for fits, its axes) stay the same
+struct ImPlotFitCache
+{
+    ImGuiID     Key;    // see GetItemFitKey
+    ImPlotRange X, Y;
+
+    ImPlotFitCache() { Key = 0; }
+};
+
+// Highest state found for one PlotDigital call of an item, kept while its data version stays the same
+struct ImPlotDigitalCache
+{
+    ImGuiID Key;  // hash of the getter and data version (see GetDigitalMax)
+    double  MaxY;
+
+    ImPlotDigitalCache() { Key = 0; MaxY = 0; }
+};
+
+// A formatted label and its text size (see ImPlotLabelCache)
+struct ImPlotLabel
+{
+    int    TextOffset;
+    ImVec2 Size;
+};
+
+// Labels formatted by an item, kept across frames while what they were formatted from (Key) is unchanged
+struct ImPlotLabelCache
+{
+    ImGuiID               Key;
+    ImVector<ImPlotLabel> Labels;
+    ImGuiTextBuffer       TextBuffer;
+    ImGuiStorage          Map;        // label id (e.g. cell index) -> index in Labels + 1
+
+    ImPlotLabelCache() { Key = 0; }
+
+    const char* GetText(const ImPlotLabel& label) const {
+        return TextBuffer.Buf.Data + label.TextOffset;
+    }
+
+    void Reset() {
+        Labels.shrink(0);
+        TextBuffer.Buf.shrink(0);
+        Map.Clear();
+    }
+};
+
 // State information for Plot items
 struct ImPlotItem
 {
@@ -946,6 +1011,17 @@ struct ImPlotItem
     bool         Show;
     bool         LegendHovered;
     bool         SeenThisFrame;
+    ImVector<ImPlotGeometryCache> Geometry;     // one per RenderPrimitives call of the item (see SetNextItemDataVersion)
+    int                           GeometryUsed; // RenderPrimitives calls made by the item this frame
+    ImVector<ImPlotPointCache>    Downsampled;     // one per downsampling getter of the item (see SetNextItemDataVersion)
+    int                           DownsampledUsed; // downsampling getters made by the item this frame
+    ImTextureID                   TexID;        // heatmap texture (see SetHeatmapTextures)
+    ImGuiID                       TexKey;       // hash of what TexID was filled from
+    ImPlotLabelCache              LabelCache;   // heatmap value labels (see SetNextItemDataVersion)
+    ImVector<ImPlotFitCache>      Fits;         // one per fitted plot call of the item (see SetNextItemDataVersion)
+    int                           FitsUsed;     // fitted plot calls made by the item this frame
+    ImVector<ImPlotDigitalCache>  DigitalMaxes;     // one per PlotDigital call of the item: its highest state
+    int                           DigitalMaxesUsed; // PlotDigital calls made by the item this frame
 
     ImPlotItem() {
         ID            = 0;
@@ -954,9 +1030,27 @@ struct ImPlotItem
         Show          = true;
         SeenThisFrame = false;
         LegendHovered = false;
+        GeometryUsed  = 0;
+        DownsampledUsed = 0;
+        FitsUsed      = 0;
+        DigitalMaxesUsed = 0;
+        TexID         = 0;
+        TexKey        = 0;
     }
 
-    ~ImPlotItem() { ID = 0; }
+    ~ImPlotItem() { ID = 0; ClearGeometry(); }
+
+    void ClearGeometry() {
+        for (int i = 0; i < Geometry.Size; ++i)
+            Geometry[i].~ImPlotGeometryCache();
+        Geometry.clear();
+        for (int i = 0; i < Downsampled.Size; ++i)
+            Downsampled[i].~ImPlotPointCache();
+        Downsampled.clear();
+        Fits.clear();
+        DigitalMaxes.clear();
+        GeometryUsed = DownsampledUsed = FitsUsed = DigitalMaxesUsed = 0;
+    }
 };
 
 // Holds Legend state
@@ -1190,6 +1284,8 @@ struct ImPlotNextItemData {
     bool            HasHidden;
     bool            Hidden;
     ImPlotCond      HiddenCond;
+    int             DownsamplePoints; // 0 = off, IMPLOT_AUTO = plot width
+    int             DataVersion;      // 0 = don't retain geometry
     ImPlotNextItemData() { Reset(); }
     void Reset() {
         for (int i = 0; i < 5; ++i)
@@ -1197,6 +1293,52 @@ struct ImPlotNextItemData {
         LineWeight    = MarkerSize = MarkerWeight = FillAlpha = ErrorBarSize = ErrorBarWeight = DigitalBitHeight = DigitalBitGap = IMPLOT_AUTO;
         Marker        = IMPLOT_AUTO;
         HasHidden     = Hidden = false;
+        DownsamplePoints = 0;
+        DataVersion      = 0;
+    }
+};
+
+// A marker rasterized into the marker atlas
+struct ImPlotMarkerSprite
+{
+    ImGuiID Key;          // marker, fill or outline, and quantized size and weight
+    int     Page;         // index in ImPlotMarkerAtlas::Pages
+    int     X, Y, Width;  // square region of the page, in pixels
+};
+
+// A fixed size RGBA32 page of the marker atlas with its own texture. Pages never resize, so the UVs of sprites
+// already drawn stay valid when later sprites are added.
+struct ImPlotMarkerAtlasPage
+{
+    ImTextureID     TexID;
+    ImVector<ImU32> Pixels;
+    int             ShelfX, ShelfY, ShelfHeight; // next free spot, packed in rows
+    bool            Dirty;                       // pixels changed since last passed to the atlas Callback
+
+    ImPlotMarkerAtlasPage() { TexID = 0; ShelfX = ShelfY = ShelfHeight = 0; Dirty = false; }
+};
+
+// CPU side of the textures that markers are rasterized into (see SetMarkerAtlas)
+struct ImPlotMarkerAtlas
+{
+    ImPlotTextureCallback           Callback;
+    void*                           CallbackData;
+    ImVector<ImPlotMarkerAtlasPage> Pages;
+    ImVector<ImPlotMarkerSprite>    Sprites;
+    ImGuiStorage                    SpriteMap; // Key -> index in Sprites + 1
+
+    ImPlotMarkerAtlas() { Callback = nullptr; CallbackData = nullptr; }
+    ~ImPlotMarkerAtlas() { Clear(); }
+    // Releases the pages' textures through the current Callback
+    void Clear() {
+        for (int i = 0; i < Pages.Size; ++i) {
+            if (Pages[i].TexID != 0 && Callback != nullptr)
+                Callback(nullptr, 0, 0, Pages[i].TexID, CallbackData);
+            Pages[i].~ImPlotMarkerAtlasPage();
+        }
+        Pages.clear();
+        Sprites.clear();
+        SpriteMap.Clear();
     }
 };
 
@@ -1229,8 +1371,22 @@ struct ImPlotContext {
     tm Tm;
 
     // Temp data for general use
-    ImVector<double>   TempDouble1, TempDouble2;
-    ImVector<int>      TempInt1;
+    ImVector<double>      TempDouble1, TempDouble2;
+    ImVector<int>         TempInt1;
+    ImVector<ImPlotPoint> TempPoint1, TempPoint2;
+
+    // Parallel rendering
+    ImPlotTaskRunner TaskRunner;
+    void*            TaskRunnerData;
+    int              TaskMinPrims;
+
+    // Marker atlas
+    ImPlotMarkerAtlas MarkerAtlas;
+
+    // Heatmap textures
+    ImPlotTextureCallback HeatmapTexCallback;
+    void*                 HeatmapTexCallbackData;
+    ImVector<ImU32>       HeatmapPixels;
 
     // Misc
     int                DigitalPlotItemCnt;
@@ -1267,6 +1423,10 @@ IMPLOT_API void ResetCtxForNextPlot(ImPlotContext* ctx);
 IMPLOT_API void ResetCtxForNextAlignedPlots(ImPlotContext* ctx);
 // Resets an ImPlot context for the next call to BeginSubplot
 IMPLOT_API void ResetCtxForNextSubplot(ImPlotContext* ctx);
+// Releases the heatmap textures of #items through the callback of #ctx (see SetHeatmapTextures)
+IMPLOT_API void ReleaseHeatmapTextures(ImPlotContext* ctx, ImPlotItemGroup& items);
+// Releases the heatmap textures of every plot and subplot of #ctx
+IMPLOT_API void ReleaseHeatmapTextures(ImPlotContext* ctx);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Utils
@@ -1311,13 +1471,46 @@ IMPLOT_API void ShowSubplotsContextMenu(ImPlotSubplot& subplot);
 // Begins a new item. Returns false if the item should not be plotted. Pushes PlotClipRect.
 IMPLOT_API bool BeginItem(const char* label_id, ImPlotItemFlags flags=0, ImPlotCol recolor_from=IMPLOT_AUTO);
 
-// Same as above but with fitting functionality.
+// Returns the key under which the current item's fit extents can be cached, or 0 if they can't be (i.e. the item has
+// no data version, see SetNextItemDataVersion, or an axis fits to the range of the other). #fitter_key hashes the
+// fitter's parameters (its Hash), e.g. data pointers, counts, and bar widths.
+IMPLOT_API ImGuiID GetItemFitKey(const ImPlotAxis& x_axis, const ImPlotAxis& y_axis, ImGuiID fitter_key);
+
+// Same as above but with fitting functionality. Items with a data version only run their fitter when it changes.
 template <typename _Fitter>
 bool BeginItemEx(const char* label_id, const _Fitter& fitter, ImPlotItemFlags flags=0, ImPlotCol recolor_from=IMPLOT_AUTO) {
     if (BeginItem(label_id, flags, recolor_from)) {
         ImPlotPlot& plot = *GetCurrentPlot();
-        if (plot.FitThisFrame && !ImHasFlag(flags, ImPlotItemFlags_NoFit))
-            fitter.Fit(plot.Axes[plot.CurrentX], plot.Axes[plot.CurrentY]);
+        if (plot.FitThisFrame && !ImHasFlag(flags, ImPlotItemFlags_NoFit)) {
+            ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+            ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+            const ImGuiID key = GetItemFitKey(x_axis, y_axis, fitter.Hash(0));
+            if (key == 0) {
+                fitter.Fit(x_axis, y_axis);
+                return true;
+            }
+            // several plot calls can share an item (same label), so each gets its own cache
+            ImPlotItem& item = *GImPlot->CurrentItem;
+            if (item.FitsUsed == item.Fits.Size)
+                item.Fits.push_back(ImPlotFitCache());
+            ImPlotFitCache& cache = item.Fits[item.FitsUsed++];
+            if (cache.Key != key) {
+                // fit the item on its own so that its extents can be merged on later frames
+                const ImPlotRange fit_x = x_axis.FitExtents;
+                const ImPlotRange fit_y = y_axis.FitExtents;
+                x_axis.FitExtents = y_axis.FitExtents = ImPlotRange(HUGE_VAL, -HUGE_VAL);
+                fitter.Fit(x_axis, y_axis);
+                cache.X   = x_axis.FitExtents;
+                cache.Y   = y_axis.FitExtents;
+                cache.Key = key;
+                x_axis.FitExtents = fit_x;
+                y_axis.FitExtents = fit_y;
+            }
+            x_axis.FitExtents.Min = ImMin(x_axis.FitExtents.Min, cache.X.Min);
+            x_axis.FitExtents.Max = ImMax(x_axis.FitExtents.Max, cache.X.Max);
+            y_axis.FitExtents.Min = ImMin(y_axis.FitExtents.Min, cache.Y.Min);
+            y_axis.FitExtents.Max = ImMax(y_axis.FitExtents.Max, cache.Y.Max);
+        }
         return true;
     }
     return false;
@@ -1335,6 +1528,11 @@ IMPLOT_API ImPlotItem* GetCurrentItem();
 // Busts the cache for every item for every plot in the current context.
 IMPLOT_API void BustItemCache();
 
+// Fills #out with the RGBA32 colors of a rows x cols heatmap (row 0 first) mapped through the current colormap.
+// This is what heatmap textures are filled with (see SetHeatmapTextures). Needs a context, but not a frame.
+template <typename T>
+IMPLOT_API void FillHeatmapPixels(const T* values, int rows, int cols, double scale_min, double scale_max, bool col_maj, ImU32* out);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Axis Utils
 //-----------------------------------------------------------------------------
@@ -60,6 +60,19 @@ static IMPLOT_INLINE float  ImInvSqrt(float x) { return _mm_cvtss_f32(_mm_rsqrt_
 static IMPLOT_INLINE float  ImInvSqrt(float x) { return 1.0f / sqrtf(x); }
 #endif
 
+// Vectorized code paths (define IMPLOT_NO_SIMD to always use the scalar fallbacks)
+#ifndef IMPLOT_NO_SIMD
+    #if defined(__SSE2__) || defined(_M_X64)
+        #define IMPLOT_SIMD_SSE2
+        #if defined(__AVX__)
+            #define IMPLOT_SIMD_AVX
+        #endif
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #include <arm_neon.h>
+        #define IMPLOT_SIMD_NEON
+    #endif
+#endif
+
 #define IMPLOT_NORMALIZE2F_OVER_ZERO(VX,VY) do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImInvSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
 
 // Support for pre-1.82 versions. Users on 1.82+ can use 0 (default) flags to mean "all corners" but in order to support older versions we are more explicit.
@@ -116,6 +129,27 @@ struct MaxIdx { static const unsigned int Value; };
 template <> const unsigned int MaxIdx<unsigned short>::Value = 65535;
 template <> const unsigned int MaxIdx<unsigned int>::Value   = 4294967295;
 
+// Number of points fetched at a time by GetBlock users (fitters, transform caches, etc.)
+static const int BLOCK_SIZE = 256;
+
+// Fewest prims (or values) worth handing to a separate task, and most tasks a single batch is split into
+static const unsigned int TASK_MIN_PRIMS = 4096;
+static const int          TASK_MAX_COUNT = 64;
+
+// Selects an overload at compile time
+template <bool B>
+struct BoolTag { };
+
+// Hashes the bytes of each argument in turn
+IMPLOT_INLINE ImGuiID HashArgs(ImGuiID seed) {
+    return seed;
+}
+
+template <typename T, typename ...Args>
+IMPLOT_INLINE ImGuiID HashArgs(ImGuiID seed, const T& arg, const Args&... args) {
+    return HashArgs(ImHashData(&arg, sizeof(T), seed), args...);
+}
+
 IMPLOT_INLINE void GetLineRenderProps(const ImDrawList& draw_list, float& half_weight, ImVec2& tex_uv0, ImVec2& tex_uv1) {
     const bool aa = ImHasFlag(draw_list.Flags, ImDrawListFlags_AntiAliasedLines) &&
                     ImHasFlag(draw_list.Flags, ImDrawListFlags_AntiAliasedLinesUseTex);
@@ -163,6 +197,69 @@ IMPLOT_INLINE void PrimLine(ImDrawList& draw_list, const ImVec2& P1, const ImVec
     draw_list._VtxCurrentIdx += 4;
 }
 
+// Returns the unit normal of the segment P1->P2 (zero if degenerate), on the same side PrimLine offsets its first vertex
+IMPLOT_INLINE ImVec2 SegmentNormal(const ImVec2& P1, const ImVec2& P2) {
+    float dx = P2.x - P1.x;
+    float dy = P2.y - P1.y;
+    IMPLOT_NORMALIZE2F_OVER_ZERO(dx, dy);
+    return ImVec2(dy, -dx);
+}
+
+// Computes the offset of the outline from the joint of two segments with unit normals n0 and n1. Returns false
+// if the miter would be longer than 10 times half_weight (the same limit as ImGui's AddPolyline), e.g. where the
+// line doubles back on itself; out is then n0 * half_weight, and the strip should end at the joint so that the
+// next segment starts a new one (i.e. the two are drawn as separate quads instead of pinching).
+IMPLOT_INLINE bool MiterOffset(const ImVec2& n0, const ImVec2& n1, float half_weight, ImVec2& out) {
+    if (n0.x == 0 && n0.y == 0) {
+        out = n1 * half_weight;
+        return true;
+    }
+    if (n1.x == 0 && n1.y == 0) {
+        out = n0 * half_weight;
+        return true;
+    }
+    const ImVec2 m = (n0 + n1) * 0.5f;
+    const float d2 = m.x * m.x + m.y * m.y;
+    if (d2 < 0.01f) {
+        out = n0 * half_weight;
+        return false;
+    }
+    out = m * (half_weight / d2);
+    return true;
+}
+
+// Appends a point offset by +/-n to a joined polyline (2 vertices per point). If connect is true, the point is
+// joined to the previously appended one with 6 indices, otherwise it starts a new chain.
+IMPLOT_INLINE void PrimStripPoint(ImDrawList& draw_list, const ImVec2& P, const ImVec2& n, ImU32 col, const ImVec2& tex_uv0, const ImVec2& tex_uv1, bool connect) {
+    draw_list._VtxWritePtr[0].pos.x = P.x + n.x;
+    draw_list._VtxWritePtr[0].pos.y = P.y + n.y;
+    draw_list._VtxWritePtr[0].uv    = tex_uv0;
+    draw_list._VtxWritePtr[0].col   = col;
+    draw_list._VtxWritePtr[1].pos.x = P.x - n.x;
+    draw_list._VtxWritePtr[1].pos.y = P.y - n.y;
+    draw_list._VtxWritePtr[1].uv    = tex_uv1;
+    draw_list._VtxWritePtr[1].col   = col;
+    draw_list._VtxWritePtr += 2;
+    if (connect) {
+        draw_list._IdxWritePtr[0] = (ImDrawIdx)(draw_list._VtxCurrentIdx - 2);
+        draw_list._IdxWritePtr[1] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+        draw_list._IdxWritePtr[2] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+        draw_list._IdxWritePtr[3] = (ImDrawIdx)(draw_list._VtxCurrentIdx - 2);
+        draw_list._IdxWritePtr[4] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+        draw_list._IdxWritePtr[5] = (ImDrawIdx)(draw_list._VtxCurrentIdx - 1);
+        draw_list._IdxWritePtr += 6;
+    }
+    draw_list._VtxCurrentIdx += 2;
+}
+
+// Releases the part of the last PrimReserve that was not written to (e.g. by culled prims)
+IMPLOT_INLINE void PrimUnreserveUnused(ImDrawList& draw_list) {
+    const int vtx_unused = (int)(draw_list.VtxBuffer.Data + draw_list.VtxBuffer.Size - draw_list._VtxWritePtr);
+    const int idx_unused = (int)(draw_list.IdxBuffer.Data + draw_list.IdxBuffer.Size - draw_list._IdxWritePtr);
+    if (vtx_unused > 0 || idx_unused > 0)
+        draw_list.PrimUnreserve(idx_unused, vtx_unused);
+}
+
 IMPLOT_INLINE void PrimRectFill(ImDrawList& draw_list, const ImVec2& Pmin, const ImVec2& Pmax, ImU32 col, const ImVec2& uv) {
     draw_list._VtxWritePtr[0].pos   = Pmin;
     draw_list._VtxWritePtr[0].uv    = uv;
@@ -189,6 +286,34 @@ IMPLOT_INLINE void PrimRectFill(ImDrawList& draw_list, const ImVec2& Pmin, const
     draw_list._VtxCurrentIdx += 4;
 }
 
+IMPLOT_INLINE void PrimRectUV(ImDrawList& draw_list, const ImVec2& Pmin, const ImVec2& Pmax, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col) {
+    draw_list._VtxWritePtr[0].pos   = Pmin;
+    draw_list._VtxWritePtr[0].uv    = uv_min;
+    draw_list._VtxWritePtr[0].col   = col;
+    draw_list._VtxWritePtr[1].pos   = Pmax;
+    draw_list._VtxWritePtr[1].uv    = uv_max;
+    draw_list._VtxWritePtr[1].col   = col;
+    draw_list._VtxWritePtr[2].pos.x = Pmin.x;
+    draw_list._VtxWritePtr[2].pos.y = Pmax.y;
+    draw_list._VtxWritePtr[2].uv.x  = uv_min.x;
+    draw_list._VtxWritePtr[2].uv.y  = uv_max.y;
+    draw_list._VtxWritePtr[2].col   = col;
+    draw_list._VtxWritePtr[3].pos.x = Pmax.x;
+    draw_list._VtxWritePtr[3].pos.y = Pmin.y;
+    draw_list._VtxWritePtr[3].uv.x  = uv_max.x;
+    draw_list._VtxWritePtr[3].uv.y  = uv_min.y;
+    draw_list._VtxWritePtr[3].col   = col;
+    draw_list._VtxWritePtr += 4;
+    draw_list._IdxWritePtr[0] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+    draw_list._IdxWritePtr[1] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+    draw_list._IdxWritePtr[2] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 2);
+    draw_list._IdxWritePtr[3] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+    draw_list._IdxWritePtr[4] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+    draw_list._IdxWritePtr[5] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 3);
+    draw_list._IdxWritePtr += 6;
+    draw_list._VtxCurrentIdx += 4;
+}
+
 IMPLOT_INLINE void PrimRectLine(ImDrawList& draw_list, const ImVec2& Pmin, const ImVec2& Pmax, float weight, ImU32 col, const ImVec2& uv) {
 
     draw_list._VtxWritePtr[0].pos.x = Pmin.x;
@@ -291,6 +416,11 @@ ImPlotItem* RegisterOrGetItem(const char* label_id, ImPlotItemFlags flags, bool*
     if (item->SeenThisFrame)
         return item;
     item->SeenThisFrame = true;
+    // retained caches are matched in order to the calls made by all of the item's plot calls this frame
+    item->GeometryUsed    = 0;
+    item->DownsampledUsed = 0;
+    item->FitsUsed        = 0;
+    item->DigitalMaxesUsed = 0;
     int idx = Items.GetItemIndex(item);
     item->ID = id;
     if (!ImHasFlag(flags, ImPlotItemFlags_NoLegend) && ImGui::FindRenderedTextEnd(label_id, nullptr) != label_id) {
@@ -319,6 +449,15 @@ ImPlotItem* GetCurrentItem() {
     return gp.CurrentItem;
 }
 
+ImGuiID GetItemFitKey(const ImPlotAxis& x_axis, const ImPlotAxis& y_axis, ImGuiID fitter_key) {
+    ImPlotContext& gp = *GImPlot;
+    const int version = gp.NextItemData.DataVersion;
+    if (version == 0 || ImHasFlag(x_axis.Flags | y_axis.Flags, ImPlotAxisFlags_RangeFit))
+        return 0;
+    ImGuiID key = HashArgs(fitter_key, version, x_axis.ID, y_axis.ID, x_axis.ConstraintRange, y_axis.ConstraintRange);
+    return key != 0 ? key : 1;
+}
+
 void SetNextLineStyle(const ImVec4& col, float weight) {
     ImPlotContext& gp = *GImPlot;
     gp.NextItemData.Colors[ImPlotCol_Line] = col;
@@ -356,6 +495,7 @@ ImVec4 GetLastItemColor() {
 
 void BustItemCache() {
     ImPlotContext& gp = *GImPlot;
+    ReleaseHeatmapTextures(&gp);
     for (int p = 0; p < gp.Plots.GetBufSize(); ++p) {
         ImPlotPlot& plot = *gp.Plots.GetByIndex(p);
         plot.Items.Reset();
@@ -374,12 +514,16 @@ void BustColorCache(const char* plot_title_id) {
     else {
         ImGuiID id = ImGui::GetCurrentWindow()->GetID(plot_title_id);
         ImPlotPlot* plot = gp.Plots.GetByKey(id);
-        if (plot != nullptr)
+        if (plot != nullptr) {
+            ReleaseHeatmapTextures(&gp, plot->Items);
             plot->Items.Reset();
+        }
         else {
             ImPlotSubplot* subplot = gp.Subplots.GetByKey(id);
-            if (subplot != nullptr)
+            if (subplot != nullptr) {
+                ReleaseHeatmapTextures(&gp, subplot->Items);
                 subplot->Items.Reset();
+            }
         }
     }
 }
@@ -466,6 +610,10 @@ bool BeginItem(const char* label_id, ImPlotItemFlags flags, ImPlotCol recolor_fr
         s.RenderFill       = s.Colors[ImPlotCol_Fill].w          > 0;
         s.RenderMarkerFill = s.Colors[ImPlotCol_MarkerFill].w    > 0;
         s.RenderMarkerLine = s.Colors[ImPlotCol_MarkerOutline].w > 0 && s.MarkerWeight > 0;
+        // release retained caches once the item has no data version, unless an earlier plot call sharing it used them
+        const bool caches_used = item->GeometryUsed > 0 || item->DownsampledUsed > 0 || item->FitsUsed > 0 || item->DigitalMaxesUsed > 0;
+        if (s.DataVersion == 0 && !caches_used && (!item->Geometry.empty() || !item->Downsampled.empty() || !item->Fits.empty() || !item->DigitalMaxes.empty()))
+            item->ClearGeometry();
         // push rendering clip rect
         PushPlotClipRect();
         return true;
@@ -500,6 +648,47 @@ IMPLOT_INLINE T IndexData(const T* data, int idx, int count, int offset, int str
     }
 }
 
+// Returns v - origin in single precision. Float data is never widened; origin must then be representable as a
+// float, which keeps the subtraction exact for values near it.
+template <typename T>
+IMPLOT_INLINE float RelativeTo(T v, double origin) { return (float)((double)v - origin); }
+IMPLOT_INLINE float RelativeTo(float v, double origin) { return v - (float)origin; }
+
+struct ConvertDouble {
+    template <typename T> IMPLOT_INLINE double operator()(T v) const { return (double)v; }
+};
+
+struct ConvertRelative {
+    ConvertRelative(double origin) : Origin(origin) { }
+    template <typename T> IMPLOT_INLINE float operator()(T v) const { return RelativeTo(v, Origin); }
+    const double Origin;
+};
+
+// Reads #n consecutive elements starting at #first into #out (spaced #out_stride elements apart), resolving offset/stride once.
+// With a non-zero offset (i.e. a ring buffer), the read is split into the spans [offset+first,count) and [0,...) so that neither needs a modulo per element.
+template <typename T, typename O, typename _Convert>
+IMPLOT_INLINE void IndexDataBlock(const T* data, int first, int n, int count, int offset, int stride, O* out, int out_stride, const _Convert& convert) {
+    if (n <= 0)
+        return;
+    int start = (offset + first) % count;
+    while (n > 0) {
+        const int m = ImMin(n, count - start);
+        if (stride == sizeof(T)) {
+            const T* src = data + start;
+            for (int i = 0; i < m; ++i)
+                out[i*out_stride] = convert(src[i]);
+        }
+        else {
+            const unsigned char* src = (const unsigned char*)data + (size_t)start * stride;
+            for (int i = 0; i < m; ++i)
+                out[i*out_stride] = convert(*(const T*)(const void*)(src + (size_t)i * stride));
+        }
+        out  += m * out_stride;
+        n    -= m;
+        start = 0;
+    }
+}
+
 template <typename T>
 struct IndexerIdx {
     IndexerIdx(const T* data, int count, int offset = 0, int stride = sizeof(T)) :
@@ -511,6 +700,13 @@ struct IndexerIdx {
     template <typename I> IMPLOT_INLINE double operator()(I idx) const {
         return (double)IndexData(Data, idx, Count, Offset, Stride);
     }
+    void GetBlock(int first, int n, double* out, int out_stride) const {
+        IndexDataBlock(Data, first, n, Count, Offset, Stride, out, out_stride, ConvertDouble());
+    }
+    void GetBlockRel(int first, int n, double origin, float* out, int out_stride) const {
+        IndexDataBlock(Data, first, n, Count, Offset, Stride, out, out_stride, ConvertRelative(origin));
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, Data, Count, Offset, Stride); }
     const T* Data;
     int Count;
     int Offset;
@@ -529,6 +725,18 @@ struct IndexerAdd {
     template <typename I> IMPLOT_INLINE double operator()(I idx) const {
         return Scale1 * Indexer1(idx) + Scale2 * Indexer2(idx);
     }
+    void GetBlock(int first, int n, double* out, int out_stride) const {
+        double tmp[BLOCK_SIZE];
+        for (int b = 0; b < n; b += BLOCK_SIZE) {
+            const int m = ImMin(BLOCK_SIZE, n - b);
+            double* dst = out + b * out_stride;
+            Indexer1.GetBlock(first + b, m, dst, out_stride);
+            Indexer2.GetBlock(first + b, m, tmp, 1);
+            for (int i = 0; i < m; ++i)
+                dst[i*out_stride] = Scale1 * dst[i*out_stride] + Scale2 * tmp[i];
+        }
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(Indexer2.Hash(Indexer1.Hash(seed)), Scale1, Scale2); }
     const _Indexer1& Indexer1;
     const _Indexer2& Indexer2;
     double Scale1;
@@ -541,6 +749,15 @@ struct IndexerLin {
     template <typename I> IMPLOT_INLINE double operator()(I idx) const {
         return M * idx + B;
     }
+    void GetBlock(int first, int n, double* out, int out_stride) const {
+        for (int i = 0; i < n; ++i)
+            out[i*out_stride] = M * (first + i) + B;
+    }
+    void GetBlockRel(int first, int n, double origin, float* out, int out_stride) const {
+        for (int i = 0; i < n; ++i)
+            out[i*out_stride] = (float)(M * (first + i) + B - origin);
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, M, B); }
     const double M;
     const double B;
 };
@@ -548,9 +765,30 @@ struct IndexerLin {
 struct IndexerConst {
     IndexerConst(double ref) : Ref(ref) { }
     template <typename I> IMPLOT_INLINE double operator()(I) const { return Ref; }
+    void GetBlock(int, int n, double* out, int out_stride) const {
+        for (int i = 0; i < n; ++i)
+            out[i*out_stride] = Ref;
+    }
+    void GetBlockRel(int, int n, double origin, float* out, int out_stride) const {
+        const float rel = (float)(Ref - origin);
+        for (int i = 0; i < n; ++i)
+            out[i*out_stride] = rel;
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, Ref); }
     const double Ref;
 };
 
+/// Describes whether an indexer has GetBlockRel (Relative), and whether its data is float (Float), in which case
+/// the origin passed to GetBlockRel must be representable as a float.
+template <typename _Indexer>
+struct IndexerTraits { static const bool Relative = false, Float = false; };
+template <>
+struct IndexerTraits<IndexerIdx<float>> { static const bool Relative = true, Float = true; };
+template <>
+struct IndexerTraits<IndexerLin> { static const bool Relative = true, Float = false; };
+template <>
+struct IndexerTraits<IndexerConst> { static const bool Relative = true, Float = false; };
+
 //-----------------------------------------------------------------------------
 // [SECTION] Getters
 //-----------------------------------------------------------------------------
@@ -561,6 +799,15 @@ struct GetterXY {
     template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
         return ImPlotPoint(IndxerX(idx),IndxerY(idx));
     }
+    void GetBlock(int first, int n, ImPlotPoint* out) const {
+        IndxerX.GetBlock(first, n, &out->x, 2);
+        IndxerY.GetBlock(first, n, &out->y, 2);
+    }
+    void GetBlockRel(int first, int n, const ImPlotPoint& origin, ImVec2* out) const {
+        IndxerX.GetBlockRel(first, n, origin.x, &out->x, 2);
+        IndxerY.GetBlockRel(first, n, origin.y, &out->y, 2);
+    }
+    ImGuiID Hash(ImGuiID seed) const { return IndxerY.Hash(IndxerX.Hash(HashArgs(seed, Count))); }
     const _IndexerX IndxerX;
     const _IndexerY IndxerY;
     const int Count;
@@ -576,6 +823,11 @@ struct GetterFuncPtr {
     template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
         return Getter(idx, Data);
     }
+    void GetBlock(int first, int n, ImPlotPoint* out) const {
+        for (int i = 0; i < n; ++i)
+            out[i] = Getter(first + i, Data);
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, Getter, Data, Count); }
     ImPlotGetter Getter;
     void* const Data;
     const int Count;
@@ -589,6 +841,18 @@ struct GetterOverrideX {
         p.x = X;
         return p;
     }
+    void GetBlock(int first, int n, ImPlotPoint* out) const {
+        Getter.GetBlock(first, n, out);
+        for (int i = 0; i < n; ++i)
+            out[i].x = X;
+    }
+    void GetBlockRel(int first, int n, const ImPlotPoint& origin, ImVec2* out) const {
+        Getter.GetBlockRel(first, n, origin, out);
+        const float rel = (float)(X - origin.x);
+        for (int i = 0; i < n; ++i)
+            out[i].x = rel;
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(Getter.Hash(seed), X); }
     const _Getter Getter;
     const double X;
     const int Count;
@@ -602,6 +866,18 @@ struct GetterOverrideY {
         p.y = Y;
         return p;
     }
+    void GetBlock(int first, int n, ImPlotPoint* out) const {
+        Getter.GetBlock(first, n, out);
+        for (int i = 0; i < n; ++i)
+            out[i].y = Y;
+    }
+    void GetBlockRel(int first, int n, const ImPlotPoint& origin, ImVec2* out) const {
+        Getter.GetBlockRel(first, n, origin, out);
+        const float rel = (float)(Y - origin.y);
+        for (int i = 0; i < n; ++i)
+            out[i].y = rel;
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(Getter.Hash(seed), Y); }
     const _Getter Getter;
     const double Y;
     const int Count;
@@ -614,10 +890,108 @@ struct GetterLoop {
         idx = idx % (Count - 1);
         return Getter(idx);
     }
+    void GetBlock(int first, int n, ImPlotPoint* out) const {
+        // split wherever the loop wraps back around to the first point
+        while (n > 0) {
+            const int i = first % (Count - 1);
+            const int m = ImMin(n, Count - 1 - i);
+            Getter.GetBlock(i, m, out);
+            first += m;
+            out   += m;
+            n     -= m;
+        }
+    }
+    void GetBlockRel(int first, int n, const ImPlotPoint& origin, ImVec2* out) const {
+        while (n > 0) {
+            const int i = first % (Count - 1);
+            const int m = ImMin(n, Count - 1 - i);
+            Getter.GetBlockRel(i, m, origin, out);
+            first += m;
+            out   += m;
+            n     -= m;
+        }
+    }
+    ImGuiID Hash(ImGuiID seed) const { return Getter.Hash(seed); }
+    const _Getter Getter;
+    const int Count;
+};
+
+/// Views the points [first,first+count) of a getter
+template <typename _Getter>
+struct GetterSlice {
+    GetterSlice(_Getter getter, int first, int count) : Getter(getter), First(first), Count(count) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return Getter(idx + First);
+    }
+    void GetBlock(int first, int n, ImPlotPoint* out) const {
+        Getter.GetBlock(first + First, n, out);
+    }
+    void GetBlockRel(int first, int n, const ImPlotPoint& origin, ImVec2* out) const {
+        Getter.GetBlockRel(first + First, n, origin, out);
+    }
+    // the range is left out, since it follows the view (see GetVisibleRangeX)
+    ImGuiID Hash(ImGuiID seed) const { return Getter.Hash(seed); }
     const _Getter Getter;
+    const int First;
     const int Count;
 };
 
+/// Describes whether a getter can read its points in single precision relative to an origin with GetBlockRel. This is
+/// only enabled when float data is involved (FloatX/FloatY), since it only saves bandwidth over reading doubles there.
+template <typename _Getter>
+struct GetterTraits { static const bool Float = false, FloatX = false, FloatY = false; };
+template <typename _IndexerX, typename _IndexerY>
+struct GetterTraits<GetterXY<_IndexerX,_IndexerY>> {
+    static const bool FloatX = IndexerTraits<_IndexerX>::Float;
+    static const bool FloatY = IndexerTraits<_IndexerY>::Float;
+    static const bool Float  = IndexerTraits<_IndexerX>::Relative && IndexerTraits<_IndexerY>::Relative && (FloatX || FloatY);
+};
+// the overridden coordinate is a double constant like IndexerConst, but keeps the getter's origin so that the pair of
+// bounds in RendererShaded take the same path
+template <typename _Getter>
+struct GetterTraits<GetterOverrideX<_Getter>> : GetterTraits<_Getter> { };
+template <typename _Getter>
+struct GetterTraits<GetterOverrideY<_Getter>> : GetterTraits<_Getter> { };
+template <typename _Getter>
+struct GetterTraits<GetterLoop<_Getter>> : GetterTraits<_Getter> { };
+template <typename _Getter>
+struct GetterTraits<GetterSlice<_Getter>> : GetterTraits<_Getter> { };
+
+// Returns the first index in [first,last) whose x value is not less than #x (x values must be increasing)
+template <typename _Getter>
+int LowerBoundX(const _Getter& getter, int first, int last, double x) {
+    while (first < last) {
+        const int mid = first + (last - first) / 2;
+        if (getter(mid).x < x)
+            first = mid + 1;
+        else
+            last = mid;
+    }
+    return first;
+}
+
+// Returns the first index in [first,last) whose x value is greater than #x (x values must be increasing)
+template <typename _Getter>
+int UpperBoundX(const _Getter& getter, int first, int last, double x) {
+    while (first < last) {
+        const int mid = first + (last - first) / 2;
+        if (!(x < getter(mid).x))
+            first = mid + 1;
+        else
+            last = mid;
+    }
+    return first;
+}
+
+// Finds the points [first,last] that can be visible on the current x-axis, i.e. the points in range plus one neighbor on each side (x values must be increasing)
+template <typename _Getter>
+void GetVisibleRangeX(const _Getter& getter, int& first, int& last) {
+    ImPlotPlot& plot = *GetCurrentPlot();
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    first = ImMax(LowerBoundX(getter, 0, getter.Count, x_axis.Range.Min) - 1, 0);
+    last  = ImMin(UpperBoundX(getter, first, getter.Count, x_axis.Range.Max), getter.Count - 1);
+}
+
 template <typename T>
 struct GetterError {
     GetterError(const T* xs, const T* ys, const T* neg, const T* pos, int count, int offset, int stride) :
@@ -635,6 +1009,13 @@ struct GetterError {
                                 (double)IndexData(Neg, idx, Count, Offset, Stride),
                                 (double)IndexData(Pos, idx, Count, Offset, Stride));
     }
+    void GetBlock(int first, int n, ImPlotPointError* out) const {
+        IndexDataBlock(Xs,  first, n, Count, Offset, Stride, &out->X,   4, ConvertDouble());
+        IndexDataBlock(Ys,  first, n, Count, Offset, Stride, &out->Y,   4, ConvertDouble());
+        IndexDataBlock(Neg, first, n, Count, Offset, Stride, &out->Neg, 4, ConvertDouble());
+        IndexDataBlock(Pos, first, n, Count, Offset, Stride, &out->Pos, 4, ConvertDouble());
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, Xs, Ys, Neg, Pos, Count, Offset, Stride); }
     const T* const Xs;
     const T* const Ys;
     const T* const Neg;
@@ -644,20 +1025,450 @@ struct GetterError {
     const int Stride;
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Reductions
+//-----------------------------------------------------------------------------
+
+// Kernels behind ImMinMaxArray, ImSum, ImMean and ImStdDev (see implot_internal.h) and FitArray. Each reduces a range of values
+// into REDUCE_LANES independent accumulators, which the compiler keeps in vector registers, and NaNs are skipped
+// with selects instead of branches (v == v is false only for NaN, and always true for integers).
+
+static const int REDUCE_LANES = 8;
+
+template <typename T>
+IMPLOT_INLINE bool IsNotNan(T v) { return v == v; }
+
+// Explicit kernels for the min and max of doubles, which the compiler will not vectorize on its own (the selects are
+// not associative without fast math). With _Fit, values rejected by ReduceMinMax::Keep are replaced by NaN, which
+// min/max then skip like any other NaN. Each folds [first,last) into lo and hi, which must not be NaN, and returns
+// where the scalar loop should resume.
+template <bool _Fit, typename T>
+IMPLOT_INLINE int MinMaxVectorized(const T*, int first, int, double, double, T&, T&) { return first; }
+
+#if defined(IMPLOT_SIMD_SSE2)
+template <bool _Fit>
+IMPLOT_INLINE __m128d MinMaxMask(__m128d v, __m128d cmin, __m128d cmax) {
+    if (!_Fit)
+        return v;
+    const __m128d keep = _mm_and_pd(_mm_cmpeq_pd(_mm_sub_pd(v, v), _mm_setzero_pd()),
+                                    _mm_and_pd(_mm_cmpge_pd(v, cmin), _mm_cmple_pd(v, cmax)));
+    return _mm_or_pd(_mm_and_pd(keep, v), _mm_andnot_pd(keep, _mm_set1_pd(NAN)));
+}
+template <bool _Fit>
+IMPLOT_INLINE int MinMaxVectorized(const double* values, int first, int last, double cmin, double cmax, double& lo, double& hi) {
+    const __m128d vmin = _mm_set1_pd(cmin);
+    const __m128d vmax = _mm_set1_pd(cmax);
+    // minpd and maxpd return their second operand when either is NaN, so the lanes keep their value
+    __m128d lo0 = _mm_set1_pd(lo), lo1 = lo0, hi0 = _mm_set1_pd(hi), hi1 = hi0;
+    int i = first;
+    for (; i + 4 <= last; i += 4) {
+        const __m128d v0 = MinMaxMask<_Fit>(_mm_loadu_pd(values + i),     vmin, vmax);
+        const __m128d v1 = MinMaxMask<_Fit>(_mm_loadu_pd(values + i + 2), vmin, vmax);
+        lo0 = _mm_min_pd(v0, lo0);
+        lo1 = _mm_min_pd(v1, lo1);
+        hi0 = _mm_max_pd(v0, hi0);
+        hi1 = _mm_max_pd(v1, hi1);
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_min_pd(lo0, lo1));
+    lo = ImMin(lanes[0], lanes[1]);
+    _mm_storeu_pd(lanes, _mm_max_pd(hi0, hi1));
+    hi = ImMax(lanes[0], lanes[1]);
+    return i;
+}
+#elif defined(IMPLOT_SIMD_NEON)
+template <bool _Fit>
+IMPLOT_INLINE float64x2_t MinMaxMask(float64x2_t v, float64x2_t cmin, float64x2_t cmax) {
+    if (!_Fit)
+        return v;
+    const uint64x2_t keep = vandq_u64(vceqq_f64(vsubq_f64(v, v), vdupq_n_f64(0)),
+                                      vandq_u64(vcgeq_f64(v, cmin), vcleq_f64(v, cmax)));
+    return vbslq_f64(keep, v, vdupq_n_f64(NAN));
+}
+template <bool _Fit>
+IMPLOT_INLINE int MinMaxVectorized(const double* values, int first, int last, double cmin, double cmax, double& lo, double& hi) {
+    const float64x2_t vmin = vdupq_n_f64(cmin);
+    const float64x2_t vmax = vdupq_n_f64(cmax);
+    // vminq/vmaxq propagate NaN, so select on the comparison instead (false for NaN, which keeps the lane)
+    float64x2_t lo0 = vdupq_n_f64(lo), lo1 = lo0, hi0 = vdupq_n_f64(hi), hi1 = hi0;
+    int i = first;
+    for (; i + 4 <= last; i += 4) {
+        const float64x2_t v0 = MinMaxMask<_Fit>(vld1q_f64(values + i),     vmin, vmax);
+        const float64x2_t v1 = MinMaxMask<_Fit>(vld1q_f64(values + i + 2), vmin, vmax);
+        lo0 = vbslq_f64(vcltq_f64(v0, lo0), v0, lo0);
+        lo1 = vbslq_f64(vcltq_f64(v1, lo1), v1, lo1);
+        hi0 = vbslq_f64(vcgtq_f64(v0, hi0), v0, hi0);
+        hi1 = vbslq_f64(vcgtq_f64(v1, hi1), v1, hi1);
+    }
+    lo = vminvq_f64(vminq_f64(lo0, lo1));
+    hi = vmaxvq_f64(vmaxq_f64(hi0, hi1));
+    return i;
+}
+#endif
+
+/// Finds the min and max of the values in a range. NaNs are always skipped. With _Fit, so are infinities and values
+/// outside [CMin,CMax], the same as calling ImPlotAxis::ExtendFit for each value.
+template <typename T, bool _Fit = false>
+struct ReduceMinMax {
+    struct Result { T Min, Max; bool Any; };
+    ReduceMinMax(const T* values) : Values(values), CMin(-HUGE_VAL), CMax(HUGE_VAL) { }
+    ReduceMinMax(const T* values, const ImPlotRange& constraint) : Values(values), CMin(constraint.Min), CMax(constraint.Max) { }
+    Result operator()(int first, int last) const {
+        Result r;
+        int i = first;
+        while (i < last && !Keep(Values[i]))
+            ++i;
+        r.Any = i < last;
+        if (!r.Any)
+            return r;
+        T lo[REDUCE_LANES], hi[REDUCE_LANES];
+        for (int l = 0; l < REDUCE_LANES; ++l)
+            lo[l] = hi[l] = Values[i];
+        i = MinMaxVectorized<_Fit>(Values, i, last, CMin, CMax, lo[0], hi[0]);
+        // a NaN compares false, so the lane keeps its value
+        for (; i + REDUCE_LANES <= last; i += REDUCE_LANES) {
+            for (int l = 0; l < REDUCE_LANES; ++l) {
+                const T v = Values[i + l];
+                const bool k = !_Fit || Keep(v);
+                lo[l] = k && v < lo[l] ? v : lo[l];
+                hi[l] = k && v > hi[l] ? v : hi[l];
+            }
+        }
+        for (; i < last; ++i) {
+            const T v = Values[i];
+            const bool k = !_Fit || Keep(v);
+            lo[0] = k && v < lo[0] ? v : lo[0];
+            hi[0] = k && v > hi[0] ? v : hi[0];
+        }
+        r.Min = lo[0];
+        r.Max = hi[0];
+        for (int l = 1; l < REDUCE_LANES; ++l)
+            Merge(r, Result{lo[l], hi[l], true});
+        return r;
+    }
+    // v - v is 0 unless v is NaN or Inf (and always for integers)
+    IMPLOT_INLINE bool Keep(T v) const {
+        return _Fit ? v - v == 0 && (double)v >= CMin && (double)v <= CMax : IsNotNan(v);
+    }
+    static void Merge(Result& a, const Result& b) {
+        if (!b.Any)
+            return;
+        if (!a.Any) {
+            a = b;
+            return;
+        }
+        a.Min = b.Min < a.Min ? b.Min : a.Min;
+        a.Max = b.Max > a.Max ? b.Max : a.Max;
+    }
+    const T* const Values;
+    const double   CMin, CMax;
+};
+
+// Number of NaNs in a range (integers have none)
+template <typename T>
+IMPLOT_INLINE int CountNans(const T*, int, int) { return 0; }
+template <typename T>
+IMPLOT_INLINE int CountFloatNans(const T* values, int first, int last) {
+    int n = 0;
+    for (int i = first; i < last; ++i)
+        n += !IsNotNan(values[i]);
+    return n;
+}
+IMPLOT_INLINE int CountNans(const float* values, int first, int last)  { return CountFloatNans(values, first, last); }
+IMPLOT_INLINE int CountNans(const double* values, int first, int last) { return CountFloatNans(values, first, last); }
+
+// Explicit kernels for summing float and double values into double accumulators, which the compiler will not
+// vectorize on its own (the NaN count and the float to double widening mix lane widths). Each adds the terms and
+// number of non-NaN values of [first,last) to sum and count, and returns where the scalar loop should resume.
+template <int _Power, typename T, typename A>
+IMPLOT_INLINE int SumVectorized(const T*, int first, int, A, A&, int&) { return first; }
+
+#if defined(IMPLOT_SIMD_SSE2)
+template <int _Power>
+IMPLOT_INLINE __m128d SumTerm(__m128d x, __m128d offset, __m128d& count) {
+    const __m128d ok = _mm_cmpord_pd(x, x);
+    const __m128d d  = _mm_sub_pd(_mm_or_pd(_mm_and_pd(ok, x), _mm_andnot_pd(ok, offset)), offset);
+    count = _mm_add_pd(count, _mm_and_pd(ok, _mm_set1_pd(1.0)));
+    return _Power == 2 ? _mm_mul_pd(d, d) : d;
+}
+IMPLOT_INLINE void SumLanes(__m128d s0, __m128d s1, __m128d c, double& sum, int& count) {
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(s0, s1));
+    sum += lanes[0] + lanes[1];
+    _mm_storeu_pd(lanes, c);
+    count += (int)(lanes[0] + lanes[1]);
+}
+template <int _Power>
+IMPLOT_INLINE int SumVectorized(const double* values, int first, int last, double offset, double& sum, int& count) {
+    const __m128d off = _mm_set1_pd(offset);
+    __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd(), c = _mm_setzero_pd();
+    int i = first;
+    for (; i + 4 <= last; i += 4) {
+        s0 = _mm_add_pd(s0, SumTerm<_Power>(_mm_loadu_pd(values + i),     off, c));
+        s1 = _mm_add_pd(s1, SumTerm<_Power>(_mm_loadu_pd(values + i + 2), off, c));
+    }
+    SumLanes(s0, s1, c, sum, count);
+    return i;
+}
+template <int _Power>
+IMPLOT_INLINE int SumVectorized(const float* values, int first, int last, double offset, double& sum, int& count) {
+    const __m128d off = _mm_set1_pd(offset);
+    __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd(), c = _mm_setzero_pd();
+    int i = first;
+    for (; i + 4 <= last; i += 4) {
+        const __m128 f = _mm_loadu_ps(values + i);
+        s0 = _mm_add_pd(s0, SumTerm<_Power>(_mm_cvtps_pd(f),                off, c));
+        s1 = _mm_add_pd(s1, SumTerm<_Power>(_mm_cvtps_pd(_mm_movehl_ps(f, f)), off, c));
+    }
+    SumLanes(s0, s1, c, sum, count);
+    return i;
+}
+#elif defined(IMPLOT_SIMD_NEON)
+template <int _Power>
+IMPLOT_INLINE float64x2_t SumTerm(float64x2_t x, float64x2_t offset, float64x2_t& count) {
+    const uint64x2_t  ok = vceqq_f64(x, x);
+    const float64x2_t d  = vsubq_f64(vbslq_f64(ok, x, offset), offset);
+    count = vaddq_f64(count, vreinterpretq_f64_u64(vandq_u64(ok, vreinterpretq_u64_f64(vdupq_n_f64(1.0)))));
+    return _Power == 2 ? vmulq_f64(d, d) : d;
+}
+IMPLOT_INLINE void SumLanes(float64x2_t s0, float64x2_t s1, float64x2_t c, double& sum, int& count) {
+    sum   += vaddvq_f64(vaddq_f64(s0, s1));
+    count += (int)vaddvq_f64(c);
+}
+template <int _Power>
+IMPLOT_INLINE int SumVectorized(const double* values, int first, int last, double offset, double& sum, int& count) {
+    const float64x2_t off = vdupq_n_f64(offset);
+    float64x2_t s0 = vdupq_n_f64(0), s1 = vdupq_n_f64(0), c = vdupq_n_f64(0);
+    int i = first;
+    for (; i + 4 <= last; i += 4) {
+        s0 = vaddq_f64(s0, SumTerm<_Power>(vld1q_f64(values + i),     off, c));
+        s1 = vaddq_f64(s1, SumTerm<_Power>(vld1q_f64(values + i + 2), off, c));
+    }
+    SumLanes(s0, s1, c, sum, count);
+    return i;
+}
+template <int _Power>
+IMPLOT_INLINE int SumVectorized(const float* values, int first, int last, double offset, double& sum, int& count) {
+    const float64x2_t off = vdupq_n_f64(offset);
+    float64x2_t s0 = vdupq_n_f64(0), s1 = vdupq_n_f64(0), c = vdupq_n_f64(0);
+    int i = first;
+    for (; i + 4 <= last; i += 4) {
+        const float32x4_t f = vld1q_f32(values + i);
+        s0 = vaddq_f64(s0, SumTerm<_Power>(vcvt_f64_f32(vget_low_f32(f)), off, c));
+        s1 = vaddq_f64(s1, SumTerm<_Power>(vcvt_high_f64_f32(f),          off, c));
+    }
+    SumLanes(s0, s1, c, sum, count);
+    return i;
+}
+#endif
+
+/// Sums (value - Offset)^Power, for Power 1 or 2, and counts the non-NaN values of a range into an accumulator of type A
+template <typename T, typename A, int _Power>
+struct ReduceSum {
+    struct Result { A Sum; int Count; };
+    ReduceSum(const T* values, A offset = 0) : Values(values), Offset(offset) { }
+    Result operator()(int first, int last) const {
+        Result r = {0, 0};
+        const int start = SumVectorized<_Power>(Values, first, last, Offset, r.Sum, r.Count);
+        // a NaN contributes Offset - Offset = 0; the lanes carry no count so that the loop stays vectorizable
+        A acc[REDUCE_LANES];
+        for (int l = 0; l < REDUCE_LANES; ++l)
+            acc[l] = 0;
+        int i = start;
+        for (; i + REDUCE_LANES <= last; i += REDUCE_LANES) {
+            for (int l = 0; l < REDUCE_LANES; ++l)
+                acc[l] += Term(Values[i + l]);
+        }
+        for (; i < last; ++i)
+            r.Sum += Term(Values[i]);
+        for (int l = 0; l < REDUCE_LANES; ++l)
+            r.Sum += acc[l];
+        r.Count += (last - start) - CountNans(Values, start, last);
+        return r;
+    }
+    IMPLOT_INLINE A Term(T v) const {
+        const A d = (IsNotNan(v) ? (A)v : Offset) - Offset;
+        return _Power == 2 ? d * d : d;
+    }
+    static void Merge(Result& a, const Result& b) {
+        a.Sum   += b.Sum;
+        a.Count += b.Count;
+    }
+    const T* const Values;
+    const A Offset;
+};
+
+// Returns how many tasks #count values are split into, each getting at least #min_per_task of them. This is 1 unless
+// a task runner is set (see SetTaskRunner) and there are at least as many values as its threshold.
+IMPLOT_INLINE int GetTaskCount(int count, int min_per_task) {
+    ImPlotContext* gp = GImPlot;
+    if (gp == nullptr || gp->TaskRunner == nullptr || count < gp->TaskMinPrims)
+        return 1;
+    return ImClamp(count / min_per_task, 1, TASK_MAX_COUNT);
+}
+
+/// Calls a kernel's operator()(task_idx, first, last) on a contiguous range of values per task
+template <typename _Kernel>
+struct RangeTask {
+    static void Run(int task_idx, void* task_data) {
+        const RangeTask& t = *(const RangeTask*)task_data;
+        const int first = ImMin(task_idx * t.ValuesPerTask, t.Count);
+        const int last  = ImMin(first + t.ValuesPerTask, t.Count);
+        (*t.Kernel)(task_idx, first, last);
+    }
+    const _Kernel* Kernel;
+    int            Count;
+    int            ValuesPerTask;
+};
+
+// Splits values [0,count) into #tasks contiguous ranges (see GetTaskCount) and runs #kernel on each of them, through
+// the task runner if there is more than one.
+template <typename _Kernel>
+void RunRangeTasks(const _Kernel& kernel, int count, int tasks) {
+    if (tasks == 1) {
+        kernel(0, 0, count);
+        return;
+    }
+    ImPlotContext& gp = *GImPlot;
+    RangeTask<_Kernel> t;
+    t.Kernel        = &kernel;
+    t.Count         = count;
+    t.ValuesPerTask = (count + tasks - 1) / tasks;
+    gp.TaskRunner(&RangeTask<_Kernel>::Run, &t, tasks, gp.TaskRunnerData);
+}
+
+/// Reduces each task's range into its own partial result
+template <typename _Kernel>
+struct ReducePartials {
+    typedef typename _Kernel::Result Result;
+    ReducePartials(const _Kernel& kernel, Result* partials) : Kernel(kernel), Partials(partials) { }
+    void operator()(int task_idx, int first, int last) const { Partials[task_idx] = Kernel(first, last); }
+    const _Kernel& Kernel;
+    Result* const  Partials;
+};
+
+// Reduces values [0,count) with a kernel, as partial results merged in order when split across tasks
+template <typename _Kernel>
+typename _Kernel::Result Reduce(const _Kernel& kernel, int count) {
+    typename _Kernel::Result partials[TASK_MAX_COUNT];
+    const int tasks = GetTaskCount(count, (int)TASK_MIN_PRIMS);
+    RunRangeTasks(ReducePartials<_Kernel>(kernel, partials), count, tasks);
+    for (int i = 1; i < tasks; ++i)
+        _Kernel::Merge(partials[0], partials[i]);
+    return partials[0];
+}
+
+} // namespace ImPlot
+
+template <typename T>
+void ImMinMaxArray(const T* values, int count, T* min_out, T* max_out) {
+    if (count <= 0) {
+        *min_out = *max_out = 0;
+        return;
+    }
+    typedef ImPlot::ReduceMinMax<T> Kernel;
+    const typename Kernel::Result r = ImPlot::Reduce(Kernel(values), count);
+    *min_out = r.Any ? r.Min : values[0];
+    *max_out = r.Any ? r.Max : values[0];
+}
+
+template <typename T>
+T ImSum(const T* values, int count) {
+    return ImPlot::Reduce(ImPlot::ReduceSum<T,T,1>(values), ImMax(count, 0)).Sum;
+}
+
+template <typename T>
+double ImMean(const T* values, int count) {
+    typedef ImPlot::ReduceSum<T,double,1> Kernel;
+    const typename Kernel::Result r = ImPlot::Reduce(Kernel(values), ImMax(count, 0));
+    return r.Count > 0 ? r.Sum / r.Count : NAN;
+}
+
+template <typename T>
+double ImStdDev(const T* values, int count) {
+    const double mu = ImMean(values, count);
+    typedef ImPlot::ReduceSum<T,double,2> Kernel;
+    const typename Kernel::Result r = ImPlot::Reduce(Kernel(values, mu), ImMax(count, 0));
+    return r.Count > 1 ? sqrt(r.Sum / (r.Count - 1)) : NAN;
+}
+
+#define INSTANTIATE_MACRO(T) \
+    template IMPLOT_API void ImMinMaxArray<T>(const T* values, int count, T* min_out, T* max_out); \
+    template IMPLOT_API T ImSum<T>(const T* values, int count); \
+    template IMPLOT_API double ImMean<T>(const T* values, int count); \
+    template IMPLOT_API double ImStdDev<T>(const T* values, int count);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+// float and double don't depend on IMPLOT_NUMERIC_TYPES (see implot_internal.h)
+#define INSTANTIATE_MACRO(T) \
+    void   ImMinMaxArray(const T* values, int count, T* min_out, T* max_out) { ImMinMaxArray<T>(values, count, min_out, max_out); } \
+    T      ImSum(const T* values, int count)    { return ImSum<T>(values, count);    } \
+    double ImMean(const T* values, int count)   { return ImMean<T>(values, count);   } \
+    double ImStdDev(const T* values, int count) { return ImStdDev<T>(values, count); }
+INSTANTIATE_MACRO(float)
+INSTANTIATE_MACRO(double)
+#undef INSTANTIATE_MACRO
+
+namespace ImPlot {
+
 //-----------------------------------------------------------------------------
 // [SECTION] Fitters
 //-----------------------------------------------------------------------------
 
+// Extends the fit of both axes with every point of a getter
+template <typename _Getter>
+void FitBlocks(const _Getter& getter, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    ImPlotPoint points[BLOCK_SIZE];
+    for (int b = 0; b < getter.Count; b += BLOCK_SIZE) {
+        const int n = ImMin(BLOCK_SIZE, getter.Count - b);
+        getter.GetBlock(b, n, points);
+        for (int i = 0; i < n; ++i) {
+            const ImPlotPoint& p = points[i];
+            x_axis.ExtendFitWith(y_axis, p.x, p.y);
+            y_axis.ExtendFitWith(x_axis, p.y, p.x);
+        }
+    }
+}
+
+// Extends the fit of an axis with the min and max of a contiguous array, the same as calling ExtendFit for each value
+template <typename T>
+void FitArray(const T* data, int count, ImPlotAxis& axis) {
+    typedef ReduceMinMax<T,true> Kernel;
+    const typename Kernel::Result r = Reduce(Kernel(data, axis.ConstraintRange), count);
+    if (!r.Any)
+        return;
+    axis.FitExtents.Min = ImMin(axis.FitExtents.Min, (double)r.Min);
+    axis.FitExtents.Max = ImMax(axis.FitExtents.Max, (double)r.Max);
+}
+
+template <typename _Getter>
+void FitPoints(const _Getter& getter, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    FitBlocks(getter, x_axis, y_axis);
+}
+
+// Unless an axis fits to the range of the other (RangeFit), each axis only depends on its own values, so tightly packed
+// arrays are reduced directly. The offset of a ring buffer doesn't matter since every element is visited.
+template <typename T>
+void FitPoints(const GetterXY<IndexerIdx<T>,IndexerIdx<T>>& getter, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    const IndexerIdx<T>& ix = getter.IndxerX;
+    const IndexerIdx<T>& iy = getter.IndxerY;
+    const bool packed = ix.Stride == sizeof(T) && iy.Stride == sizeof(T) && ix.Count == getter.Count && iy.Count == getter.Count;
+    if (!packed || ImHasFlag(x_axis.Flags | y_axis.Flags, ImPlotAxisFlags_RangeFit)) {
+        FitBlocks(getter, x_axis, y_axis);
+        return;
+    }
+    FitArray(ix.Data, getter.Count, x_axis);
+    FitArray(iy.Data, getter.Count, y_axis);
+}
+
 template <typename _Getter1>
 struct Fitter1 {
     Fitter1(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-        for (int i = 0; i < Getter.Count; ++i) {
-            ImPlotPoint p = Getter(i);
-            x_axis.ExtendFitWith(y_axis, p.x, p.y);
-            y_axis.ExtendFitWith(x_axis, p.y, p.x);
-        }
+        FitPoints(Getter, x_axis, y_axis);
     }
+    ImGuiID Hash(ImGuiID seed) const { return Getter.Hash(HashArgs(seed, '1')); }
     const _Getter1& Getter;
 };
 
@@ -665,11 +1476,15 @@ template <typename _Getter1>
 struct FitterX {
     FitterX(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis&) const {
-        for (int i = 0; i < Getter.Count; ++i) {
-            ImPlotPoint p = Getter(i);
-            x_axis.ExtendFit(p.x);
+        ImPlotPoint points[BLOCK_SIZE];
+        for (int b = 0; b < Getter.Count; b += BLOCK_SIZE) {
+            const int n = ImMin(BLOCK_SIZE, Getter.Count - b);
+            Getter.GetBlock(b, n, points);
+            for (int i = 0; i < n; ++i)
+                x_axis.ExtendFit(points[i].x);
         }
     }
+    ImGuiID Hash(ImGuiID seed) const { return Getter.Hash(HashArgs(seed, 'X')); }
     const _Getter1& Getter;
 };
 
@@ -677,11 +1492,15 @@ template <typename _Getter1>
 struct FitterY {
     FitterY(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis&, ImPlotAxis& y_axis) const {
-        for (int i = 0; i < Getter.Count; ++i) {
-            ImPlotPoint p = Getter(i);
-            y_axis.ExtendFit(p.y);
+        ImPlotPoint points[BLOCK_SIZE];
+        for (int b = 0; b < Getter.Count; b += BLOCK_SIZE) {
+            const int n = ImMin(BLOCK_SIZE, Getter.Count - b);
+            Getter.GetBlock(b, n, points);
+            for (int i = 0; i < n; ++i)
+                y_axis.ExtendFit(points[i].y);
         }
     }
+    ImGuiID Hash(ImGuiID seed) const { return Getter.Hash(HashArgs(seed, 'Y')); }
     const _Getter1& Getter;
 };
 
@@ -689,17 +1508,10 @@ template <typename _Getter1, typename _Getter2>
 struct Fitter2 {
     Fitter2(const _Getter1& getter1, const _Getter2& getter2) : Getter1(getter1), Getter2(getter2) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-        for (int i = 0; i < Getter1.Count; ++i) {
-            ImPlotPoint p = Getter1(i);
-            x_axis.ExtendFitWith(y_axis, p.x, p.y);
-            y_axis.ExtendFitWith(x_axis, p.y, p.x);
-        }
-        for (int i = 0; i < Getter2.Count; ++i) {
-            ImPlotPoint p = Getter2(i);
-            x_axis.ExtendFitWith(y_axis, p.x, p.y);
-            y_axis.ExtendFitWith(x_axis, p.y, p.x);
-        }
+        Fitter1<_Getter1>(Getter1).Fit(x_axis, y_axis);
+        Fitter1<_Getter2>(Getter2).Fit(x_axis, y_axis);
     }
+    ImGuiID Hash(ImGuiID seed) const { return Getter2.Hash(Getter1.Hash(HashArgs(seed, '2'))); }
     const _Getter1& Getter1;
     const _Getter2& Getter2;
 };
@@ -712,16 +1524,24 @@ struct FitterBarV {
         HalfWidth(width*0.5)
     { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        ImPlotPoint points1[BLOCK_SIZE];
+        ImPlotPoint points2[BLOCK_SIZE];
         int count = ImMin(Getter1.Count, Getter2.Count);
-        for (int i = 0; i < count; ++i) {
-            ImPlotPoint p1 = Getter1(i); p1.x -= HalfWidth;
-            ImPlotPoint p2 = Getter2(i); p2.x += HalfWidth;
-            x_axis.ExtendFitWith(y_axis, p1.x, p1.y);
-            y_axis.ExtendFitWith(x_axis, p1.y, p1.x);
-            x_axis.ExtendFitWith(y_axis, p2.x, p2.y);
-            y_axis.ExtendFitWith(x_axis, p2.y, p2.x);
+        for (int b = 0; b < count; b += BLOCK_SIZE) {
+            const int n = ImMin(BLOCK_SIZE, count - b);
+            Getter1.GetBlock(b, n, points1);
+            Getter2.GetBlock(b, n, points2);
+            for (int i = 0; i < n; ++i) {
+                ImPlotPoint p1 = points1[i]; p1.x -= HalfWidth;
+                ImPlotPoint p2 = points2[i]; p2.x += HalfWidth;
+                x_axis.ExtendFitWith(y_axis, p1.x, p1.y);
+                y_axis.ExtendFitWith(x_axis, p1.y, p1.x);
+                x_axis.ExtendFitWith(y_axis, p2.x, p2.y);
+                y_axis.ExtendFitWith(x_axis, p2.y, p2.x);
+            }
         }
     }
+    ImGuiID Hash(ImGuiID seed) const { return Getter2.Hash(Getter1.Hash(HashArgs(seed, 'V', HalfWidth))); }
     const _Getter1& Getter1;
     const _Getter2& Getter2;
     const double    HalfWidth;
@@ -735,16 +1555,24 @@ struct FitterBarH {
         HalfHeight(height*0.5)
     { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        ImPlotPoint points1[BLOCK_SIZE];
+        ImPlotPoint points2[BLOCK_SIZE];
         int count = ImMin(Getter1.Count, Getter2.Count);
-        for (int i = 0; i < count; ++i) {
-            ImPlotPoint p1 = Getter1(i); p1.y -= HalfHeight;
-            ImPlotPoint p2 = Getter2(i); p2.y += HalfHeight;
-            x_axis.ExtendFitWith(y_axis, p1.x, p1.y);
-            y_axis.ExtendFitWith(x_axis, p1.y, p1.x);
-            x_axis.ExtendFitWith(y_axis, p2.x, p2.y);
-            y_axis.ExtendFitWith(x_axis, p2.y, p2.x);
+        for (int b = 0; b < count; b += BLOCK_SIZE) {
+            const int n = ImMin(BLOCK_SIZE, count - b);
+            Getter1.GetBlock(b, n, points1);
+            Getter2.GetBlock(b, n, points2);
+            for (int i = 0; i < n; ++i) {
+                ImPlotPoint p1 = points1[i]; p1.y -= HalfHeight;
+                ImPlotPoint p2 = points2[i]; p2.y += HalfHeight;
+                x_axis.ExtendFitWith(y_axis, p1.x, p1.y);
+                y_axis.ExtendFitWith(x_axis, p1.y, p1.x);
+                x_axis.ExtendFitWith(y_axis, p2.x, p2.y);
+                y_axis.ExtendFitWith(x_axis, p2.y, p2.x);
+            }
         }
     }
+    ImGuiID Hash(ImGuiID seed) const { return Getter2.Hash(Getter1.Hash(HashArgs(seed, 'H', HalfHeight))); }
     const _Getter1& Getter1;
     const _Getter2& Getter2;
     const double    HalfHeight;
@@ -764,6 +1592,7 @@ struct FitterRect {
         x_axis.ExtendFitWith(y_axis, Pmax.x, Pmax.y);
         y_axis.ExtendFitWith(x_axis, Pmax.y, Pmax.x);
     }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, 'R', Pmin, Pmax); }
     const ImPlotPoint Pmin;
     const ImPlotPoint Pmax;
 };
@@ -772,8 +1601,11 @@ struct FitterRect {
 // [SECTION] Transformers
 //-----------------------------------------------------------------------------
 
+/// Maps one plot axis to pixels. Built-in scales are identified by Scale and call their transforms directly, so that
+/// Apply<> can be instantiated per scale with the transform inlined; user transforms (Scale == IMPLOT_AUTO) go through
+/// the function pointer.
 struct Transformer1 {
-    Transformer1(double pixMin, double pltMin, double pltMax, double m, double scaMin, double scaMax, ImPlotTransform fwd, void* data) :
+    Transformer1(double pixMin, double pltMin, double pltMax, double m, double scaMin, double scaMax, ImPlotTransform fwd, void* data, ImPlotScale scale) :
         ScaMin(scaMin),
         ScaMax(scaMax),
         PltMin(pltMin),
@@ -781,12 +1613,25 @@ struct Transformer1 {
         PixMin(pixMin),
         M(m),
         TransformFwd(fwd),
-        TransformData(data)
+        TransformData(data),
+        Scale(fwd == nullptr ? ImPlotScale_Linear : (scale == ImPlotScale_Log10 || scale == ImPlotScale_SymLog) ? scale : IMPLOT_AUTO)
     { }
 
     template <typename T> IMPLOT_INLINE float operator()(T p) const {
-        if (TransformFwd != nullptr) {
-            double s = TransformFwd(p, TransformData);
+        switch (Scale) {
+            case ImPlotScale_Linear: return Apply<ImPlotScale_Linear>((double)p);
+            case ImPlotScale_Log10:  return Apply<ImPlotScale_Log10>((double)p);
+            case ImPlotScale_SymLog: return Apply<ImPlotScale_SymLog>((double)p);
+            default:                 return Apply<IMPLOT_AUTO>((double)p);
+        }
+    }
+
+    // _Scale is a compile time constant, so all but one branch folds away
+    template <int _Scale> IMPLOT_INLINE float Apply(double p) const {
+        if (_Scale != ImPlotScale_Linear) {
+            double s = _Scale == ImPlotScale_Log10  ? TransformForward_Log10(p, nullptr)
+                     : _Scale == ImPlotScale_SymLog ? TransformForward_SymLog(p, nullptr)
+                     : TransformFwd(p, TransformData);
             double t = (s - ScaMin) / (ScaMax - ScaMin);
             p = PltMin + (PltMax - PltMin) * t;
         }
@@ -796,6 +1641,7 @@ struct Transformer1 {
     double ScaMin, ScaMax, PltMin, PltMax, PixMin, M;
     ImPlotTransform TransformFwd;
     void*           TransformData;
+    ImPlotScale     Scale;
 };
 
 struct Transformer2 {
@@ -807,7 +1653,8 @@ struct Transformer2 {
            x_axis.ScaleMin,
            x_axis.ScaleMax,
            x_axis.TransformForward,
-           x_axis.TransformData),
+           x_axis.TransformData,
+           x_axis.Scale),
         Ty(y_axis.PixelMin,
            y_axis.Range.Min,
            y_axis.Range.Max,
@@ -815,7 +1662,8 @@ struct Transformer2 {
            y_axis.ScaleMin,
            y_axis.ScaleMax,
            y_axis.TransformForward,
-           y_axis.TransformData)
+           y_axis.TransformData,
+           y_axis.Scale)
     { }
 
     Transformer2(const ImPlotPlot& plot) :
@@ -840,20 +1688,391 @@ struct Transformer2 {
         return out;
     }
 
+    // Transforms a span of points. When both axes are linear, this is vectorized; otherwise the loop is
+    // specialized for the scale of each axis.
+    void operator()(const ImPlotPoint* plt, int count, ImVec2* out) const {
+        int i = 0;
+        if (Tx.Scale == ImPlotScale_Linear && Ty.Scale == ImPlotScale_Linear) {
+            // same operations and order as Transformer1, so results match the scalar path exactly
+#if defined(IMPLOT_SIMD_AVX)
+            const __m256d plt_min = _mm256_setr_pd(Tx.PltMin, Ty.PltMin, Tx.PltMin, Ty.PltMin);
+            const __m256d m       = _mm256_setr_pd(Tx.M,      Ty.M,      Tx.M,      Ty.M);
+            const __m256d pix_min = _mm256_setr_pd(Tx.PixMin, Ty.PixMin, Tx.PixMin, Ty.PixMin);
+            for (; i + 2 <= count; i += 2) {
+                __m256d p = _mm256_loadu_pd(&plt[i].x);
+                p = _mm256_add_pd(pix_min, _mm256_mul_pd(m, _mm256_sub_pd(p, plt_min)));
+                _mm_storeu_ps(&out[i].x, _mm256_cvtpd_ps(p));
+            }
+#elif defined(IMPLOT_SIMD_SSE2)
+            const __m128d plt_min = _mm_setr_pd(Tx.PltMin, Ty.PltMin);
+            const __m128d m       = _mm_setr_pd(Tx.M,      Ty.M);
+            const __m128d pix_min = _mm_setr_pd(Tx.PixMin, Ty.PixMin);
+            for (; i < count; ++i) {
+                __m128d p = _mm_loadu_pd(&plt[i].x);
+                p = _mm_add_pd(pix_min, _mm_mul_pd(m, _mm_sub_pd(p, plt_min)));
+                _mm_storel_pi((__m64*)&out[i].x, _mm_cvtpd_ps(p));
+            }
+#elif defined(IMPLOT_SIMD_NEON)
+            const double plt_min_v[2] = { Tx.PltMin, Ty.PltMin };
+            const double m_v[2]       = { Tx.M,      Ty.M      };
+            const double pix_min_v[2] = { Tx.PixMin, Ty.PixMin };
+            const float64x2_t plt_min = vld1q_f64(plt_min_v);
+            const float64x2_t m       = vld1q_f64(m_v);
+            const float64x2_t pix_min = vld1q_f64(pix_min_v);
+            for (; i < count; ++i) {
+                float64x2_t p = vld1q_f64(&plt[i].x);
+                p = vaddq_f64(pix_min, vmulq_f64(m, vsubq_f64(p, plt_min)));
+                vst1_f32(&out[i].x, vcvt_f32_f64(p));
+            }
+#endif
+            TransformBlock<ImPlotScale_Linear, ImPlotScale_Linear>(plt + i, count - i, out + i);
+            return;
+        }
+        switch (Tx.Scale) {
+            case ImPlotScale_Linear: TransformBlockX<ImPlotScale_Linear>(plt, count, out); break;
+            case ImPlotScale_Log10:  TransformBlockX<ImPlotScale_Log10>(plt, count, out);  break;
+            case ImPlotScale_SymLog: TransformBlockX<ImPlotScale_SymLog>(plt, count, out); break;
+            default:                 TransformBlockX<IMPLOT_AUTO>(plt, count, out);        break;
+        }
+    }
+
+    template <int _ScaleX>
+    void TransformBlockX(const ImPlotPoint* plt, int count, ImVec2* out) const {
+        switch (Ty.Scale) {
+            case ImPlotScale_Linear: TransformBlock<_ScaleX, ImPlotScale_Linear>(plt, count, out); break;
+            case ImPlotScale_Log10:  TransformBlock<_ScaleX, ImPlotScale_Log10>(plt, count, out);  break;
+            case ImPlotScale_SymLog: TransformBlock<_ScaleX, ImPlotScale_SymLog>(plt, count, out); break;
+            default:                 TransformBlock<_ScaleX, IMPLOT_AUTO>(plt, count, out);        break;
+        }
+    }
+
+    template <int _ScaleX, int _ScaleY>
+    void TransformBlock(const ImPlotPoint* plt, int count, ImVec2* out) const {
+        for (int i = 0; i < count; ++i) {
+            out[i].x = Tx.Apply<_ScaleX>(plt[i].x);
+            out[i].y = Ty.Apply<_ScaleY>(plt[i].y);
+        }
+    }
+
     Transformer1 Tx;
     Transformer1 Ty;
 };
 
+/// Transforms the points of a getter a block at a time so that linear axes take the vectorized path.
+/// Intended for renderers that visit points in increasing order; any index is valid, but jumping around refills the block.
+template <typename _Getter>
+struct TransformCache {
+    TransformCache(const _Getter& getter, const Transformer2& transformer) :
+        Getter(getter),
+        Transformer(transformer),
+        First(0),
+        Size(0)
+    {
+        // float data on linear axes is read and transformed in single precision, relative to an origin at the
+        // low end of the view so that large axis offsets don't cost precision
+        const Transformer1& tx = Transformer.Tx;
+        const Transformer1& ty = Transformer.Ty;
+        Relative = GetterTraits<_Getter>::Float && tx.Scale == ImPlotScale_Linear && ty.Scale == ImPlotScale_Linear;
+        if (Relative) {
+            Origin.x  = GetterTraits<_Getter>::FloatX ? (double)(float)tx.PltMin : tx.PltMin;
+            Origin.y  = GetterTraits<_Getter>::FloatY ? (double)(float)ty.PltMin : ty.PltMin;
+            OriginPix = Transformer(Origin);
+            Scale     = ImVec2((float)tx.M, (float)ty.M);
+        }
+    }
+    IMPLOT_INLINE ImVec2 operator()(int idx) const {
+        if ((unsigned int)(idx - First) >= (unsigned int)Size)
+            Fill(idx);
+        return Pixels[idx - First];
+    }
+    void Fill(int idx) const {
+        First = idx;
+        Size  = ImMin(BLOCK_SIZE, Getter.Count - idx);
+        FillBlock(BoolTag<GetterTraits<_Getter>::Float>());
+    }
+    void FillBlock(BoolTag<false>) const {
+        Getter.GetBlock(First, Size, Points);
+        Transformer(Points, Size, Pixels);
+    }
+    void FillBlock(BoolTag<true>) const {
+        if (!Relative) {
+            FillBlock(BoolTag<false>());
+            return;
+        }
+        Getter.GetBlockRel(First, Size, Origin, Pixels);
+        for (int i = 0; i < Size; ++i) {
+            Pixels[i].x = OriginPix.x + Scale.x * Pixels[i].x;
+            Pixels[i].y = OriginPix.y + Scale.y * Pixels[i].y;
+        }
+    }
+    const _Getter& Getter;
+    const Transformer2 Transformer;
+    bool Relative;
+    ImPlotPoint Origin;
+    ImVec2 OriginPix;
+    ImVec2 Scale;
+    mutable int First;
+    mutable int Size;
+    mutable ImPlotPoint Points[BLOCK_SIZE];
+    mutable ImVec2 Pixels[BLOCK_SIZE];
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] Downsamplers
+//-----------------------------------------------------------------------------
+
+// Hashes everything that maps the current plot's data to pixels
+static ImGuiID HashPlotView(ImGuiID seed) {
+    const ImPlotPlot& plot = *GetCurrentPlot();
+    seed = HashArgs(seed, plot.PlotRect.Min, plot.PlotRect.Max);
+    const ImPlotAxis* axes[2] = { &plot.Axes[plot.CurrentX], &plot.Axes[plot.CurrentY] };
+    for (int i = 0; i < 2; ++i) {
+        const ImPlotAxis& a = *axes[i];
+        seed = HashArgs(seed, a.Range, a.PixelMin, a.PixelMax, a.ScaleMin, a.ScaleMax, a.TransformForward, a.TransformData);
+    }
+    return seed;
+}
+
+// Returns the buffer a downsampler should write its points to. For items with a data version (see SetNextItemDataVersion)
+// this is retained by the item, and #hit is set if it already holds the points for #key, so that retained geometry
+// isn't preceded by an O(N) pass every frame.
+static ImVector<ImPlotPoint>& GetDownsampleBuffer(ImVector<ImPlotPoint>& temp, ImGuiID key, bool& hit) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotItem* item = gp.CurrentItem;
+    hit = false;
+    if (item == nullptr || gp.NextItemData.DataVersion == 0)
+        return temp;
+    if (item->DownsampledUsed == item->Downsampled.Size)
+        item->Downsampled.push_back(ImPlotPointCache());
+    ImPlotPointCache& cache = item->Downsampled[item->DownsampledUsed++];
+    key  = HashArgs(key, gp.NextItemData.DataVersion);
+    hit  = cache.Key == key;
+    cache.Key = key;
+    return cache.Points;
+}
+
+/// Folds a getter into the first, min, max, and last points of each pixel column (M4 decimation).
+/// Rasterizes the same as the source polyline, but yields at most four points per column for increasing x.
+template <typename _Getter>
+struct GetterM4 {
+    GetterM4(const _Getter& getter, ImVector<ImPlotPoint>& buffer) :
+        Key(getter.Hash(HashArgs(0, 'M'))),
+        Points(Decimated(getter, buffer, Key)),
+        Count(Points.Size)
+    { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return Points.Data[idx];
+    }
+    void GetBlock(int first, int n, ImPlotPoint* out) const {
+        memcpy(out, Points.Data + first, n * sizeof(ImPlotPoint));
+    }
+    // the points follow from the source getter and the view, which retained geometry is keyed by anyway
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, Key); }
+    static ImVector<ImPlotPoint>& Decimated(const _Getter& getter, ImVector<ImPlotPoint>& buffer, ImGuiID key) {
+        bool hit;
+        ImVector<ImPlotPoint>& out = GetDownsampleBuffer(buffer, HashPlotView(key), hit);
+        if (!hit)
+            Decimate(getter, out);
+        return out;
+    }
+    static int Decimate(const _Getter& getter, ImVector<ImPlotPoint>& out) {
+        const Transformer2 transformer;
+        const ImRect& plot_rect = GetCurrentPlot()->PlotRect;
+        // everything off either side of the plot is folded into a single column
+        const float col_min = plot_rect.Min.x - 1;
+        const float col_max = plot_rect.Max.x + 1;
+        out.resize(0);
+        int col = 0, n = 0;
+        int   idx[4]; // first, min, max, last
+        float pix_min = 0, pix_max = 0;
+        for (int i = 0; i < getter.Count; ++i) {
+            const ImPlotPoint p = getter(i);
+            const ImVec2 P = transformer(p);
+            if (ImNan(P.x) || ImNan(P.y)) {
+                // flush and pass through so the line breaks (or skips) exactly as it would have
+                FlushColumn(getter, idx, n, out);
+                out.push_back(p);
+                n = 0;
+                continue;
+            }
+            const int c = (int)ImFloor(ImClamp(P.x, col_min, col_max));
+            if (n == 0 || c != col) {
+                FlushColumn(getter, idx, n, out);
+                col = c;
+                n = 1;
+                idx[0] = idx[1] = idx[2] = idx[3] = i;
+                pix_min = pix_max = P.y;
+                continue;
+            }
+            if (P.y < pix_min) { pix_min = P.y; idx[1] = i; }
+            if (P.y > pix_max) { pix_max = P.y; idx[2] = i; }
+            idx[3] = i;
+            ++n;
+        }
+        FlushColumn(getter, idx, n, out);
+        return out.Size;
+    }
+    static IMPLOT_INLINE void FlushColumn(const _Getter& getter, int idx[4], int n, ImVector<ImPlotPoint>& out) {
+        if (n == 0)
+            return;
+        if (idx[1] > idx[2])
+            ImSwap(idx[1], idx[2]);
+        int prev = -1;
+        for (int k = 0; k < 4; ++k) {
+            if (idx[k] != prev)
+                out.push_back(getter(idx[k]));
+            prev = idx[k];
+        }
+    }
+    const ImGuiID Key; // hash of the source getter
+    const ImVector<ImPlotPoint>& Points;
+    const int Count;
+};
+
+/// Downsamples the visible x range of a getter to a point budget with Largest-Triangle-Three-Buckets.
+/// The neighbors just outside the visible range are kept so that lines continue to the plot edges.
+template <typename _Getter>
+struct GetterLTTB {
+    GetterLTTB(const _Getter& getter, ImVector<ImPlotPoint>& buffer, int max_points) :
+        Key(getter.Hash(HashArgs(0, 'L', max_points))),
+        Points(Downsampled(getter, buffer, max_points, Key)),
+        Count(Points.Size)
+    { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return Points.Data[idx];
+    }
+    void GetBlock(int first, int n, ImPlotPoint* out) const {
+        memcpy(out, Points.Data + first, n * sizeof(ImPlotPoint));
+    }
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, Key); }
+    static ImVector<ImPlotPoint>& Downsampled(const _Getter& getter, ImVector<ImPlotPoint>& buffer, int max_points, ImGuiID key) {
+        bool hit;
+        ImVector<ImPlotPoint>& out = GetDownsampleBuffer(buffer, HashPlotView(key), hit);
+        if (!hit)
+            Downsample(getter, out, max_points);
+        return out;
+    }
+    static int Downsample(const _Getter& getter, ImVector<ImPlotPoint>& out, int max_points) {
+        if (max_points < 0)
+            max_points = (int)GetCurrentPlot()->PlotRect.GetWidth();
+        max_points = ImMax(max_points, 3);
+        int first, last;
+        GetVisibleRangeX(getter, first, last);
+        const int n = last - first + 1;
+        out.resize(0);
+        if (n <= 0)
+            return 0;
+        if (n <= max_points) {
+            out.resize(n);
+            for (int i = 0; i < n; ++i)
+                out.Data[i] = getter(first + i);
+            return n;
+        }
+        // triangle areas are measured in pixels so that log and other scales are honored
+        const Transformer2 transformer;
+        out.reserve(max_points);
+        out.push_back(getter(first));
+        ImVec2 a = transformer(out.back());
+        const double every = (double)(n - 2) / (max_points - 2);
+        for (int b = 0; b < max_points - 2; ++b) {
+            // average of the next bucket (or the last point for the final bucket)
+            const int avg_first = first + 1 + (int)((b + 1) * every);
+            const int avg_last  = ImMin(first + 1 + (int)((b + 2) * every), last + 1);
+            ImVec2 avg(0,0);
+            int avg_count = 0;
+            for (int i = avg_first; i < avg_last; ++i) {
+                const ImVec2 P = transformer(getter(i));
+                if (ImNan(P.x) || ImNan(P.y))
+                    continue;
+                avg += P;
+                avg_count++;
+            }
+            if (avg_count > 0)
+                avg = avg / (float)avg_count;
+            else
+                avg = transformer(getter(last));
+            // point in this bucket forming the largest triangle with the previous pick and the next average
+            const int bkt_first = first + 1 + (int)(b * every);
+            const int bkt_last  = first + 1 + (int)((b + 1) * every);
+            int pick = bkt_first;
+            float pick_area = -1;
+            ImVec2 pick_pix = a;
+            for (int i = bkt_first; i < bkt_last; ++i) {
+                const ImVec2 P = transformer(getter(i));
+                const float area = ImAbs((a.x - avg.x) * (P.y - a.y) - (a.x - P.x) * (avg.y - a.y));
+                if (area > pick_area) {
+                    pick_area = area;
+                    pick      = i;
+                    pick_pix  = P;
+                }
+            }
+            out.push_back(getter(pick));
+            a = pick_pix;
+        }
+        out.push_back(getter(last));
+        return out.Size;
+    }
+    const ImGuiID Key; // hash of the source getter and point budget
+    const ImVector<ImPlotPoint>& Points;
+    const int Count;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Renderers
 //-----------------------------------------------------------------------------
 
+// Renderers cull their prims with cull_rect.Overlaps(rect) or CullContains(cull_rect, point), where cull_rect
+// is either an ImRect or a CullRectExcluding.
+
+/// Culls against a rect, but also rejects anything that falls in an excluded region (i.e. geometry that is already present).
+struct CullRectExcluding {
+    CullRectExcluding(const ImRect& rect, const ImRect& excluded) : Rect(rect), Excluded(excluded) { }
+    IMPLOT_INLINE bool Overlaps(const ImRect& r) const { return Rect.Overlaps(r) && !Excluded.Overlaps(r); }
+    ImRect Rect;
+    ImRect Excluded;
+};
+
+IMPLOT_INLINE bool CullContains(const ImRect& cull_rect, const ImVec2& p) {
+    return p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y;
+}
+
+IMPLOT_INLINE bool CullContains(const CullRectExcluding& cull_rect, const ImVec2& p) {
+    return CullContains(cull_rect.Rect, p) && !CullContains(cull_rect.Excluded, p);
+}
+
+// Value of a joined polyline renderer's Chain when the next prim can't connect to previously written vertices
+static const unsigned int NO_CHAIN = 0xFFFFFFFF;
+
+/// Vertical span a polyline renderer has drawn in the pixel column of its last point. A point that falls inside
+/// the span and is followed by another point in the same column adds nothing visible, so such runs collapse to
+/// the column's extrema plus the point that leaves it. NaNs never compare equal, so they are never collapsed.
+struct ColumnSpan {
+    void Reset(const ImVec2& P) {
+        X   = floorf(P.x);
+        Min = Max = P.y;
+    }
+    void Add(const ImVec2& P) {
+        if (floorf(P.x) != X) {
+            Reset(P);
+            return;
+        }
+        Min = ImMin(Min, P.y);
+        Max = ImMax(Max, P.y);
+    }
+    IMPLOT_INLINE bool Collapses(const ImVec2& P, const ImVec2& next) const {
+        return P.y >= Min && P.y <= Max && floorf(P.x) == X && floorf(next.x) == X;
+    }
+    float X, Min, Max;
+};
+
 struct RendererBase {
     RendererBase(int prims, int idx_consumed, int vtx_consumed) :
         Prims(prims),
         IdxConsumed(idx_consumed),
         VtxConsumed(vtx_consumed)
     { }
+    // restores any state carried between consecutive prims so rendering can start at #prim
+    void Seek(int) const { }
     const int Prims;
     Transformer2 Transformer;
     const int IdxConsumed;
@@ -865,30 +2084,58 @@ struct RendererLineStrip : RendererBase {
     RendererLineStrip(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 6, 4),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Col(col),
-        HalfWeight(ImMax(1.0f,weight)*0.5f)
+        HalfWeight(ImMax(1.0f,weight)*0.5f),
+        Chain(NO_CHAIN)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Pixels(0);
+        Span.Reset(P1);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+    void Seek(int prim) const {
+        P1 = Pixels(prim);
+        Span.Reset(P1);
+        Chain = NO_CHAIN;
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P2 = Pixels(prim + 1);
+        const bool has_next = prim + 2 <= Prims;
+        const ImVec2 P3 = has_next ? Pixels(prim + 2) : P2;
+        if (has_next && Span.Collapses(P2, P3))
+            return false;
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
+            Span.Reset(P2);
+            Chain = NO_CHAIN;
             return false;
         }
-        PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
+        const ImVec2 N12 = SegmentNormal(P1, P2);
+        ImVec2 N23 = N12;
+        if (has_next && !ImNan(P3.x) && !ImNan(P3.y))
+            N23 = SegmentNormal(P2, P3);
+        ImVec2 M2;
+        const bool joined = MiterOffset(N12, N23, HalfWeight, M2);
+        if (draw_list._VtxCurrentIdx != Chain)
+            PrimStripPoint(draw_list, P1, N12 * HalfWeight, Col, UV0, UV1, false);
+        PrimStripPoint(draw_list, P2, M2, Col, UV0, UV1, true);
+        Chain = joined ? draw_list._VtxCurrentIdx : NO_CHAIN;
         P1 = P2;
+        Span.Add(P2);
         return true;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
     mutable ImVec2 UV0;
     mutable ImVec2 UV1;
+    mutable ColumnSpan Span;
+    mutable unsigned int Chain;
 };
 
 template <class _Getter>
@@ -896,32 +2143,65 @@ struct RendererLineStripSkip : RendererBase {
     RendererLineStripSkip(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 6, 4),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Col(col),
-        HalfWeight(ImMax(1.0f,weight)*0.5f)
+        HalfWeight(ImMax(1.0f,weight)*0.5f),
+        Chain(NO_CHAIN)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Pixels(0);
+        Span.Reset(P1);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+    void Seek(int prim) const {
+        // last valid point at or before prim (scanned without the cache, which only fills forward)
+        P1 = Pixels(prim);
+        for (int i = prim; i > 0 && (ImNan(P1.x) || ImNan(P1.y)); )
+            P1 = this->Transformer(Getter(--i));
+        Span.Reset(P1);
+        Chain = NO_CHAIN;
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P2 = Pixels(prim + 1);
+        const bool has_next = prim + 2 <= Prims;
+        const ImVec2 P3 = has_next ? Pixels(prim + 2) : P2;
+        if (has_next && Span.Collapses(P2, P3))
+            return false;
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
-            if (!ImNan(P2.x) && !ImNan(P2.y))
+            if (!ImNan(P2.x) && !ImNan(P2.y)) {
                 P1 = P2;
+                Span.Reset(P2);
+            }
+            Chain = NO_CHAIN;
             return false;
         }
-        PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
-        if (!ImNan(P2.x) && !ImNan(P2.y))
+        const ImVec2 N12 = SegmentNormal(P1, P2);
+        ImVec2 N23 = N12;
+        if (has_next && !ImNan(P3.x) && !ImNan(P3.y))
+            N23 = SegmentNormal(P2, P3);
+        ImVec2 M2;
+        const bool joined = MiterOffset(N12, N23, HalfWeight, M2);
+        if (draw_list._VtxCurrentIdx != Chain)
+            PrimStripPoint(draw_list, P1, N12 * HalfWeight, Col, UV0, UV1, false);
+        PrimStripPoint(draw_list, P2, M2, Col, UV0, UV1, true);
+        Chain = joined ? draw_list._VtxCurrentIdx : NO_CHAIN;
+        if (!ImNan(P2.x) && !ImNan(P2.y)) {
             P1 = P2;
+            Span.Add(P2);
+        }
         return true;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
     mutable ImVec2 UV0;
     mutable ImVec2 UV1;
+    mutable ColumnSpan Span;
+    mutable unsigned int Chain;
 };
 
 template <class _Getter>
@@ -929,21 +2209,24 @@ struct RendererLineSegments1 : RendererBase {
     RendererLineSegments1(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count / 2, 6, 4),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     { }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P1 = this->Transformer(Getter(prim*2+0));
-        ImVec2 P2 = this->Transformer(Getter(prim*2+1));
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P1 = Pixels(prim*2+0);
+        ImVec2 P2 = Pixels(prim*2+1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
         PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
         return true;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 UV0;
@@ -962,7 +2245,8 @@ struct RendererLineSegments2 : RendererBase {
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
         ImVec2 P1 = this->Transformer(Getter1(prim));
         ImVec2 P2 = this->Transformer(Getter2(prim));
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
@@ -978,6 +2262,46 @@ struct RendererLineSegments2 : RendererBase {
     mutable ImVec2 UV1;
 };
 
+/// Renders an error bar from each point of getter1 to the matching point of getter2, with a whisker of 2*#whisker pixels
+/// across each end (none if #whisker is zero)
+template <class _Getter1, class _Getter2>
+struct RendererErrorBars : RendererBase {
+    RendererErrorBars(const _Getter1& getter1, const _Getter2& getter2, ImU32 col, float weight, const ImVec2& whisker) :
+        RendererBase(ImMin(getter1.Count, getter2.Count), HasWhiskers(whisker) ? 18 : 6, HasWhiskers(whisker) ? 12 : 4),
+        Getter1(getter1),
+        Getter2(getter2),
+        Col(col),
+        HalfWeight(ImMax(1.0f,weight)*0.5f),
+        Whisker(whisker),
+        Whiskers(HasWhiskers(whisker))
+    {}
+    static bool HasWhiskers(const ImVec2& whisker) { return whisker.x > 0 || whisker.y > 0; }
+    void Init(ImDrawList& draw_list) const {
+        GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P1 = this->Transformer(Getter1(prim));
+        ImVec2 P2 = this->Transformer(Getter2(prim));
+        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2) - Whisker, ImMax(P1, P2) + Whisker)))
+            return false;
+        PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
+        if (Whiskers) {
+            PrimLine(draw_list,P1-Whisker,P1+Whisker,HalfWeight,Col,UV0,UV1);
+            PrimLine(draw_list,P2-Whisker,P2+Whisker,HalfWeight,Col,UV0,UV1);
+        }
+        return true;
+    }
+    const _Getter1& Getter1;
+    const _Getter2& Getter2;
+    const ImU32 Col;
+    mutable float HalfWeight;
+    const ImVec2 Whisker;
+    const bool Whiskers;
+    mutable ImVec2 UV0;
+    mutable ImVec2 UV1;
+};
+
 template <class _Getter1, class _Getter2>
 struct RendererBarsFillV : RendererBase {
     RendererBarsFillV(const _Getter1& getter1, const _Getter2& getter2, ImU32 col, double width) :
@@ -990,7 +2314,8 @@ struct RendererBarsFillV : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
         ImPlotPoint p1 = Getter1(prim);
         ImPlotPoint p2 = Getter2(prim);
         p1.x += HalfWidth;
@@ -1028,7 +2353,8 @@ struct RendererBarsFillH : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
         ImPlotPoint p1 = Getter1(prim);
         ImPlotPoint p2 = Getter2(prim);
         p1.y += HalfHeight;
@@ -1067,7 +2393,8 @@ struct RendererBarsLineV : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
         ImPlotPoint p1 = Getter1(prim);
         ImPlotPoint p2 = Getter2(prim);
         p1.x += HalfWidth;
@@ -1107,7 +2434,8 @@ struct RendererBarsLineH : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
         ImPlotPoint p1 = Getter1(prim);
         ImPlotPoint p2 = Getter2(prim);
         p1.y += HalfHeight;
@@ -1138,63 +2466,137 @@ struct RendererBarsLineH : RendererBase {
 template <class _Getter>
 struct RendererStairsPre : RendererBase {
     RendererStairsPre(const _Getter& getter, ImU32 col, float weight) :
-        RendererBase(getter.Count - 1, 12, 8),
+        RendererBase(getter.Count - 1, 12, 6),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Col(col),
-        HalfWeight(ImMax(1.0f,weight)*0.5f)
+        HalfWeight(ImMax(1.0f,weight)*0.5f),
+        Chain(NO_CHAIN)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Pixels(0);
+        Span.Reset(P1);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+    void Seek(int prim) const {
+        P1 = Pixels(prim);
+        Span.Reset(P1);
+        Chain = NO_CHAIN;
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P2 = Pixels(prim + 1);
+        const bool has_next = prim + 2 <= Prims;
+        const ImVec2 P3 = has_next ? Pixels(prim + 2) : P2;
+        if (has_next && Span.Collapses(P2, P3))
+            return false;
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
+            Span.Reset(P2);
+            Chain = NO_CHAIN;
             return false;
         }
-        PrimRectFill(draw_list, ImVec2(P1.x - HalfWeight, P1.y), ImVec2(P1.x + HalfWeight, P2.y), Col, UV);
-        PrimRectFill(draw_list, ImVec2(P1.x, P2.y + HalfWeight), ImVec2(P2.x, P2.y - HalfWeight), Col, UV);
+        // vertical step at P1.x, then across to P2
+        const ImVec2 C = ImVec2(P1.x, P2.y);
+        const ImVec2 N1 = SegmentNormal(P1, C);
+        const ImVec2 N2 = SegmentNormal(C, P2);
+        ImVec2 N3 = N2;
+        if (has_next && !ImNan(P3.x) && !ImNan(P3.y)) {
+            const ImVec2 C3 = ImVec2(P2.x, P3.y);
+            N3 = SegmentNormal(P2, C3);
+            if (N3.x == 0 && N3.y == 0)
+                N3 = SegmentNormal(C3, P3);
+        }
+        // the corner at C is square (or degenerate), so it always joins
+        ImVec2 MC, M2;
+        MiterOffset(N1, N2, HalfWeight, MC);
+        const bool joined = MiterOffset(N2, N3, HalfWeight, M2);
+        if (draw_list._VtxCurrentIdx != Chain)
+            PrimStripPoint(draw_list, P1, (N1.x != 0 || N1.y != 0 ? N1 : N2) * HalfWeight, Col, UV, UV, false);
+        PrimStripPoint(draw_list, C, MC, Col, UV, UV, true);
+        PrimStripPoint(draw_list, P2, M2, Col, UV, UV, true);
+        Chain = joined ? draw_list._VtxCurrentIdx : NO_CHAIN;
         P1 = P2;
+        Span.Add(P2);
         return true;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
     mutable ImVec2 UV;
+    mutable ColumnSpan Span;
+    mutable unsigned int Chain;
 };
 
 template <class _Getter>
 struct RendererStairsPost : RendererBase {
     RendererStairsPost(const _Getter& getter, ImU32 col, float weight) :
-        RendererBase(getter.Count - 1, 12, 8),
+        RendererBase(getter.Count - 1, 12, 6),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Col(col),
-        HalfWeight(ImMax(1.0f,weight) * 0.5f)
+        HalfWeight(ImMax(1.0f,weight)*0.5f),
+        Chain(NO_CHAIN)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Pixels(0);
+        Span.Reset(P1);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+    void Seek(int prim) const {
+        P1 = Pixels(prim);
+        Span.Reset(P1);
+        Chain = NO_CHAIN;
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P2 = Pixels(prim + 1);
+        const bool has_next = prim + 2 <= Prims;
+        const ImVec2 P3 = has_next ? Pixels(prim + 2) : P2;
+        if (has_next && Span.Collapses(P2, P3))
+            return false;
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
+            Span.Reset(P2);
+            Chain = NO_CHAIN;
             return false;
         }
-        PrimRectFill(draw_list, ImVec2(P1.x, P1.y + HalfWeight), ImVec2(P2.x, P1.y - HalfWeight), Col, UV);
-        PrimRectFill(draw_list, ImVec2(P2.x - HalfWeight, P2.y), ImVec2(P2.x + HalfWeight, P1.y), Col, UV);
+        // across to P2.x, then vertical step to P2
+        const ImVec2 C = ImVec2(P2.x, P1.y);
+        const ImVec2 N1 = SegmentNormal(P1, C);
+        const ImVec2 N2 = SegmentNormal(C, P2);
+        ImVec2 N3 = N2;
+        if (has_next && !ImNan(P3.x) && !ImNan(P3.y)) {
+            const ImVec2 C3 = ImVec2(P3.x, P2.y);
+            N3 = SegmentNormal(P2, C3);
+            if (N3.x == 0 && N3.y == 0)
+                N3 = SegmentNormal(C3, P3);
+        }
+        // the corner at C is square (or degenerate), so it always joins
+        ImVec2 MC, M2;
+        MiterOffset(N1, N2, HalfWeight, MC);
+        const bool joined = MiterOffset(N2, N3, HalfWeight, M2);
+        if (draw_list._VtxCurrentIdx != Chain)
+            PrimStripPoint(draw_list, P1, (N1.x != 0 || N1.y != 0 ? N1 : N2) * HalfWeight, Col, UV, UV, false);
+        PrimStripPoint(draw_list, C, MC, Col, UV, UV, true);
+        PrimStripPoint(draw_list, P2, M2, Col, UV, UV, true);
+        Chain = joined ? draw_list._VtxCurrentIdx : NO_CHAIN;
         P1 = P2;
+        Span.Add(P2);
         return true;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
     mutable ImVec2 UV;
+    mutable ColumnSpan Span;
+    mutable unsigned int Chain;
 };
 
 template <class _Getter>
@@ -1202,16 +2604,21 @@ struct RendererStairsPreShaded : RendererBase {
     RendererStairsPreShaded(const _Getter& getter, ImU32 col) :
         RendererBase(getter.Count - 1, 6, 4),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Pixels(0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+    void Seek(int prim) const {
+        P1 = Pixels(prim);
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P2 = Pixels(prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(Y0, P2.y));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(Y0, P2.y));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1223,6 +2630,7 @@ struct RendererStairsPreShaded : RendererBase {
         return true;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImU32 Col;
     float Y0;
     mutable ImVec2 P1;
@@ -1234,16 +2642,21 @@ struct RendererStairsPostShaded : RendererBase {
     RendererStairsPostShaded(const _Getter& getter, ImU32 col) :
         RendererBase(getter.Count - 1, 6, 4),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Pixels(0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+    void Seek(int prim) const {
+        P1 = Pixels(prim);
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P2 = Pixels(prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(P1.y, Y0));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(P1.y, Y0));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1255,6 +2668,7 @@ struct RendererStairsPostShaded : RendererBase {
         return true;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImU32 Col;
     float Y0;
     mutable ImVec2 P1;
@@ -1269,17 +2683,24 @@ struct RendererShaded : RendererBase {
         RendererBase(ImMin(getter1.Count, getter2.Count) - 1, 6, 5),
         Getter1(getter1),
         Getter2(getter2),
+        Pixels1(getter1, this->Transformer),
+        Pixels2(getter2, this->Transformer),
         Col(col)
     {
-        P11 = this->Transformer(Getter1(0));
-        P12 = this->Transformer(Getter2(0));
+        P11 = Pixels1(0);
+        P12 = Pixels2(0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P21 = this->Transformer(Getter1(prim+1));
-        ImVec2 P22 = this->Transformer(Getter2(prim+1));
+    void Seek(int prim) const {
+        P11 = Pixels1(prim);
+        P12 = Pixels2(prim);
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 P21 = Pixels1(prim+1);
+        ImVec2 P22 = Pixels2(prim+1);
         ImRect rect(ImMin(ImMin(ImMin(P11,P12),P21),P22), ImMax(ImMax(ImMax(P11,P12),P21),P22));
         if (!cull_rect.Overlaps(rect)) {
             P11 = P21;
@@ -1318,6 +2739,8 @@ struct RendererShaded : RendererBase {
     }
     const _Getter1& Getter1;
     const _Getter2& Getter2;
+    const TransformCache<_Getter1> Pixels1;
+    const TransformCache<_Getter2> Pixels2;
     const ImU32 Col;
     mutable ImVec2 P11;
     mutable ImVec2 P12;
@@ -1339,7 +2762,8 @@ struct RendererRectC : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
         RectC rect = Getter(prim);
         ImVec2 P1 = this->Transformer(rect.Pos.x - rect.HalfSize.x , rect.Pos.y - rect.HalfSize.y);
         ImVec2 P2 = this->Transformer(rect.Pos.x + rect.HalfSize.x , rect.Pos.y + rect.HalfSize.y);
@@ -1352,62 +2776,382 @@ struct RendererRectC : RendererBase {
     mutable ImVec2 UV;
 };
 
+/// Renders a digital signal as one filled rect per run of equal states, from the x of the run's first point to the x of the
+/// next state. Only the first point of a run emits, so a run split across tasks is still drawn once.
+template <typename _Getter>
+struct RendererDigital : RendererBase {
+    RendererDigital(const _Getter& getter, ImU32 col, float y_base, float line_weight, float bit_height, float x_min, float x_max) :
+        RendererBase(getter.Count - 1, 6, 4),
+        Getter(getter),
+        Col(col),
+        YBase(y_base),
+        LineWeight((int)line_weight),
+        BitHeight(bit_height),
+        XMin(x_min),
+        XMax(x_max)
+    {}
+    void Init(ImDrawList& draw_list) const {
+        UV = draw_list._Data->TexUvWhitePixel;
+    }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        const ImPlotPoint p = Getter(prim);
+        if (ImNanOrInf(p.y) || (prim > 0 && Getter(prim - 1).y == p.y))
+            return false;
+        int next = prim + 1;
+        while (next < Getter.Count - 1 && Getter(next).y == p.y)
+            ++next;
+        // do not extend outside of the plot (see https://github.com/ocornut/imgui/issues/3976)
+        const float x1 = ImClamp(this->Transformer.Tx(p.x), XMin, XMax - 1);
+        const float x2 = ImClamp(this->Transformer.Tx(Getter(next).x), XMin, XMax - 1);
+        const float y2 = YBase - (float)(LineWeight + (int)(BitHeight * (float)ImMax(0.0, p.y)));
+        if (!(x2 > x1) || !cull_rect.Overlaps(ImRect(x1, y2, x2, YBase)))
+            return false;
+        PrimRectFill(draw_list, ImVec2(x1, y2), ImVec2(x2, YBase), Col, UV);
+        return true;
+    }
+    const _Getter& Getter;
+    const ImU32 Col;
+    const float YBase;
+    const int   LineWeight;
+    const float BitHeight;
+    const float XMin, XMax;
+    mutable ImVec2 UV;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] RenderPrimitives
 //-----------------------------------------------------------------------------
 
-/// Renders primitive shapes in bulk as efficiently as possible.
-template <class _Renderer>
-void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
-    unsigned int prims        = renderer.Prims;
-    unsigned int prims_culled = 0;
-    unsigned int idx          = 0;
+/// One reserved batch of prims split into contiguous ranges, each rendered by a task into its own slice of the reservation.
+template <class _Renderer, class _Cull>
+struct RenderPrimitivesTask {
+    static void Run(int task_idx, void* task_data) {
+        const RenderPrimitivesTask& t = *(const RenderPrimitivesTask*)task_data;
+        const unsigned int first = task_idx * t.PrimsPerTask;
+        const unsigned int last  = ImMin(first + t.PrimsPerTask, t.Cnt);
+        ImDrawVert* vtx_start = t.VtxBase + first * t.Renderer->VtxConsumed;
+        ImDrawIdx*  idx_start = t.IdxBase + first * t.Renderer->IdxConsumed;
+        // each task renders with its own copy of the renderer (and its transform cache) into a shell draw list
+        const _Renderer renderer(*t.Renderer);
+        ImDrawList draw_list(t.SharedData);
+        draw_list._VtxWritePtr   = vtx_start;
+        draw_list._IdxWritePtr   = idx_start;
+        draw_list._VtxCurrentIdx = t.VtxCurrentIdx + first * t.Renderer->VtxConsumed;
+        renderer.Seek(t.First + first);
+        for (unsigned int prim = first; prim != last; ++prim)
+            renderer.Render(draw_list, *t.CullRect, t.First + prim);
+        t.VtxWritten[task_idx] = (unsigned int)(draw_list._VtxWritePtr - vtx_start);
+        t.IdxWritten[task_idx] = (unsigned int)(draw_list._IdxWritePtr - idx_start);
+    }
+    const _Renderer*      Renderer;
+    const _Cull*          CullRect;
+    ImDrawListSharedData* SharedData;
+    ImDrawVert*           VtxBase;
+    ImDrawIdx*            IdxBase;
+    unsigned int          VtxCurrentIdx;
+    unsigned int          First;
+    unsigned int          Cnt;
+    unsigned int          PrimsPerTask;
+    mutable unsigned int  VtxWritten[TASK_MAX_COUNT];
+    mutable unsigned int  IdxWritten[TASK_MAX_COUNT];
+};
+
+/// Renders primitive shapes [first,last) in bulk across the tasks of the user's task runner (see SetTaskRunner).
+template <class _Renderer, class _Cull>
+void RenderPrimitivesParallel(const _Renderer& renderer, ImDrawList& draw_list, const _Cull& cull_rect, int first, int last) {
+    ImPlotContext& gp = *GImPlot;
+    unsigned int prims = last - first;
+    unsigned int idx   = first;
     renderer.Init(draw_list);
+    RenderPrimitivesTask<_Renderer,_Cull> t;
+    t.Renderer   = &renderer;
+    t.CullRect   = &cull_rect;
+    t.SharedData = draw_list._Data;
     while (prims) {
-        // find how many can be reserved up to end of current draw command's limit
+        // reserve as much as the current draw command allows, or a whole new one (see RenderPrimitivesEx)
         unsigned int cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - draw_list._VtxCurrentIdx) / renderer.VtxConsumed);
-        // make sure at least this many elements can be rendered to avoid situations where at the end of buffer this slow path is not taken all the time
-        if (cnt >= ImMin(64u, prims)) {
-            if (prims_culled >= cnt)
-                prims_culled -= cnt; // reuse previous reservation
-            else {
-                // add more elements to previous reservation
-                draw_list.PrimReserve((cnt - prims_culled) * renderer.IdxConsumed, (cnt - prims_culled) * renderer.VtxConsumed);
-                prims_culled = 0;
-            }
-        }
+        if (cnt < ImMin(64u, prims))
+            cnt = ImMin(prims, MaxIdx<ImDrawIdx>::Value / renderer.VtxConsumed);
+        draw_list.PrimReserve(cnt * renderer.IdxConsumed, cnt * renderer.VtxConsumed);
+        const int tasks  = ImClamp((int)(cnt / TASK_MIN_PRIMS), 1, TASK_MAX_COUNT);
+        t.VtxBase        = draw_list._VtxWritePtr;
+        t.IdxBase        = draw_list._IdxWritePtr;
+        t.VtxCurrentIdx  = draw_list._VtxCurrentIdx;
+        t.First          = idx;
+        t.Cnt            = cnt;
+        t.PrimsPerTask   = (cnt + tasks - 1) / tasks;
+        if (tasks > 1)
+            gp.TaskRunner(&RenderPrimitivesTask<_Renderer,_Cull>::Run, &t, tasks, gp.TaskRunnerData);
         else
-        {
-            if (prims_culled > 0) {
-                draw_list.PrimUnreserve(prims_culled * renderer.IdxConsumed, prims_culled * renderer.VtxConsumed);
-                prims_culled = 0;
+            RenderPrimitivesTask<_Renderer,_Cull>::Run(0, &t);
+        // compact the slices, dropping the space reserved for culled prims and rebasing indices accordingly
+        ImDrawVert* vtx_dst = t.VtxBase;
+        ImDrawIdx*  idx_dst = t.IdxBase;
+        for (int i = 0; i < tasks; ++i) {
+            const unsigned int first = i * t.PrimsPerTask;
+            ImDrawVert* vtx_src = t.VtxBase + first * renderer.VtxConsumed;
+            ImDrawIdx*  idx_src = t.IdxBase + first * renderer.IdxConsumed;
+            const ImDrawIdx shift = (ImDrawIdx)(vtx_src - vtx_dst);
+            if (vtx_dst != vtx_src)
+                memmove(vtx_dst, vtx_src, t.VtxWritten[i] * sizeof(ImDrawVert));
+            if (idx_dst != idx_src || shift != 0) {
+                for (unsigned int j = 0; j < t.IdxWritten[i]; ++j)
+                    idx_dst[j] = (ImDrawIdx)(idx_src[j] - shift);
             }
-            cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - 0/*draw_list._VtxCurrentIdx*/) / renderer.VtxConsumed);
-            // reserve new draw command
-            draw_list.PrimReserve(cnt * renderer.IdxConsumed, cnt * renderer.VtxConsumed);
+            vtx_dst += t.VtxWritten[i];
+            idx_dst += t.IdxWritten[i];
         }
+        const unsigned int vtx_unused = cnt * renderer.VtxConsumed - (unsigned int)(vtx_dst - t.VtxBase);
+        const unsigned int idx_unused = cnt * renderer.IdxConsumed - (unsigned int)(idx_dst - t.IdxBase);
+        draw_list._VtxWritePtr   = vtx_dst;
+        draw_list._IdxWritePtr   = idx_dst;
+        draw_list._VtxCurrentIdx = t.VtxCurrentIdx + (unsigned int)(vtx_dst - t.VtxBase);
+        if (vtx_unused > 0 || idx_unused > 0)
+            draw_list.PrimUnreserve(idx_unused, vtx_unused);
         prims -= cnt;
-        for (unsigned int ie = idx + cnt; idx != ie; ++idx) {
-            if (!renderer.Render(draw_list, cull_rect, idx))
-                prims_culled++;
+        idx   += cnt;
+    }
+}
+
+/// Renders primitive shapes [first,last) in bulk as efficiently as possible.
+template <class _Renderer, class _Cull>
+void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const _Cull& cull_rect, int first, int last) {
+    ImPlotContext& gp = *GImPlot;
+    if (first >= last)
+        return;
+    if (gp.TaskRunner != nullptr && last - first >= gp.TaskMinPrims) {
+        RenderPrimitivesParallel(renderer, draw_list, cull_rect, first, last);
+        return;
+    }
+    unsigned int prims = last - first;
+    unsigned int idx   = first;
+    renderer.Init(draw_list);
+    if (first != 0)
+        renderer.Seek(first);
+    while (prims) {
+        // find how many can be reserved up to end of current draw command's limit
+        unsigned int cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - draw_list._VtxCurrentIdx) / renderer.VtxConsumed);
+        // make sure at least this many elements can be rendered to avoid situations where at the end of buffer this slow path is not taken all the time
+        if (cnt < ImMin(64u, prims)) {
+            // PrimReserve will start a new draw command
+            cnt = ImMin(prims, MaxIdx<ImDrawIdx>::Value / renderer.VtxConsumed);
+        }
+        draw_list.PrimReserve(cnt * renderer.IdxConsumed, cnt * renderer.VtxConsumed);
+        prims -= cnt;
+        for (unsigned int ie = idx + cnt; idx != ie; ++idx)
+            renderer.Render(draw_list, cull_rect, idx);
+        // renderers may write less than they consume per prim (e.g. culled or joined prims)
+        PrimUnreserveUnused(draw_list);
+    }
+}
+
+/// Renders all primitive shapes of a renderer.
+template <class _Renderer, class _Cull>
+void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const _Cull& cull_rect) {
+    RenderPrimitivesEx(renderer, draw_list, cull_rect, 0, renderer.Prims);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Retained Geometry
+//-----------------------------------------------------------------------------
+
+/// Unique address per renderer type, used to tell retained geometry of different renderers apart.
+template <class _Renderer>
+struct RendererTypeId {
+    static const char Id;
+};
+template <class _Renderer>
+const char RendererTypeId<_Renderer>::Id = 0;
+
+// Hashes the parts of a transform that must match exactly for retained geometry to be reused. The plot range
+// and scale are compared separately so that pans of linear axes can be recognized.
+static ImGuiID HashTransform(const Transformer1& tf, ImGuiID seed) {
+    seed = HashArgs(seed, tf.PixMin, tf.TransformFwd, tf.TransformData);
+    return tf.TransformFwd != nullptr ? HashArgs(seed, tf.ScaMin, tf.ScaMax) : seed;
+}
+
+// Returns true if two linear transforms of the same key differ only by a translation (to well below a pixel over the plot)
+static bool IsTranslation(const Transformer1& tf, double plt_min, double plt_max, double scale) {
+    return tf.TransformFwd == nullptr && ImAbs(tf.M - scale) * ImAbs(plt_max - plt_min) < 0.01;
+}
+
+// Copies the geometry appended to draw_list since (cmd0, vtx0, idx0) into cache, one run per draw command
+static void CaptureGeometry(ImPlotGeometryCache& cache, const ImDrawList& draw_list, int cmd0, int vtx0, int idx0) {
+    cache.Vtx.resize(draw_list.VtxBuffer.Size - vtx0);
+    cache.Idx.resize(draw_list.IdxBuffer.Size - idx0);
+    cache.Runs.resize(0);
+    if (cache.Vtx.Size > 0)
+        memcpy(cache.Vtx.Data, draw_list.VtxBuffer.Data + vtx0, cache.Vtx.Size * sizeof(ImDrawVert));
+    for (int c = cmd0; c < draw_list.CmdBuffer.Size; ++c) {
+        const ImDrawCmd& cmd = draw_list.CmdBuffer[c];
+        const int idx_beg = ImMax((int)cmd.IdxOffset, idx0);
+        const int idx_end = (int)(cmd.IdxOffset + cmd.ElemCount);
+        const int vtx_beg = ImMax((int)cmd.VtxOffset, vtx0);
+        const int vtx_end = c + 1 < draw_list.CmdBuffer.Size ? (int)draw_list.CmdBuffer[c+1].VtxOffset : draw_list.VtxBuffer.Size;
+        if (idx_end <= idx_beg)
+            continue;
+        ImPlotGeometryRun run;
+        run.VtxOffset = vtx_beg - vtx0;
+        run.VtxCount  = vtx_end - vtx_beg;
+        run.IdxOffset = idx_beg - idx0;
+        run.IdxCount  = idx_end - idx_beg;
+        cache.Runs.push_back(run);
+        // indices are stored relative to the run's first vertex
+        const unsigned int base = (unsigned int)vtx_beg - cmd.VtxOffset;
+        for (int i = idx_beg; i < idx_end; ++i)
+            cache.Idx[i - idx0] = (ImDrawIdx)(draw_list.IdxBuffer[i] - base);
+    }
+}
+
+// Appends retained geometry to draw_list
+static void ReplayGeometry(const ImPlotGeometryCache& cache, ImDrawList& draw_list) {
+    for (int r = 0; r < cache.Runs.Size; ++r) {
+        const ImPlotGeometryRun& run = cache.Runs[r];
+        draw_list.PrimReserve(run.IdxCount, run.VtxCount);
+        memcpy(draw_list._VtxWritePtr, cache.Vtx.Data + run.VtxOffset, run.VtxCount * sizeof(ImDrawVert));
+        const ImDrawIdx* idx_src = cache.Idx.Data + run.IdxOffset;
+        for (int i = 0; i < run.IdxCount; ++i)
+            draw_list._IdxWritePtr[i] = (ImDrawIdx)(draw_list._VtxCurrentIdx + idx_src[i]);
+        draw_list._VtxWritePtr   += run.VtxCount;
+        draw_list._IdxWritePtr   += run.IdxCount;
+        draw_list._VtxCurrentIdx += run.VtxCount;
+    }
+}
+
+// Appends retained geometry to draw_list translated by offset, dropping prims (each idx_consumed indices) that no longer
+// overlap cull_rect. Vertices are copied per run since prims may share them.
+static void ReplayGeometry(const ImPlotGeometryCache& cache, ImDrawList& draw_list, const ImVec2& offset, const ImRect& cull_rect, int idx_consumed) {
+    for (int r = 0; r < cache.Runs.Size; ++r) {
+        const ImPlotGeometryRun& run = cache.Runs[r];
+        const ImDrawVert* vtx_src = cache.Vtx.Data + run.VtxOffset;
+        const ImDrawIdx*  idx_src = cache.Idx.Data + run.IdxOffset;
+        draw_list.PrimReserve(run.IdxCount, run.VtxCount);
+        ImDrawVert* vtx_dst = draw_list._VtxWritePtr;
+        for (int i = 0; i < run.VtxCount; ++i) {
+            vtx_dst[i]      = vtx_src[i];
+            vtx_dst[i].pos += offset;
+        }
+        for (int i = 0; i < run.IdxCount; i += idx_consumed) {
+            ImRect bounds(vtx_dst[idx_src[i]].pos, vtx_dst[idx_src[i]].pos);
+            for (int j = 1; j < idx_consumed; ++j)
+                bounds.Add(vtx_dst[idx_src[i+j]].pos);
+            if (!cull_rect.Overlaps(bounds))
+                continue;
+            for (int j = 0; j < idx_consumed; ++j)
+                draw_list._IdxWritePtr[j] = (ImDrawIdx)(draw_list._VtxCurrentIdx + idx_src[i+j]);
+            draw_list._IdxWritePtr += idx_consumed;
+        }
+        // keep the run's vertices only if any of its prims are still visible
+        if (draw_list._IdxWritePtr != draw_list.IdxBuffer.Data + draw_list.IdxBuffer.Size - run.IdxCount) {
+            draw_list._VtxWritePtr   += run.VtxCount;
+            draw_list._VtxCurrentIdx += run.VtxCount;
+        }
+        PrimUnreserveUnused(draw_list);
+    }
+}
+
+// Finds the prims [first,last) that can reach the plot x range [x_min,x_max]. This is only possible if the x values of
+// the renderer's getter are increasing, i.e. it is the GetterSlice of an ImPlotItemFlags_SortedX item. Prims are spread
+// evenly over the points (one per point, per pair of neighbors, or per pair of points), and one neighbor on each side
+// is included for prims that cross into the range.
+template <typename _Getter>
+bool FindPrimsX(const _Getter&, int, double, double, int&, int&) { return false; }
+template <typename _Getter>
+bool FindPrimsX(const GetterSlice<_Getter>& getter, int prims, double x_min, double x_max, int& first, int& last) {
+    if (getter.Count <= 0)
+        return false;
+    const int a = ImMax(LowerBoundX(getter, 0, getter.Count, x_min) - 1, 0);
+    const int b = ImMin(UpperBoundX(getter, a, getter.Count, x_max) + 1, getter.Count);
+    first = (int)((ImS64)a * prims / getter.Count);
+    last  = (int)(((ImS64)b * prims + getter.Count - 1) / getter.Count);
+    return true;
+}
+
+/// Renders primitives through RenderPrimitivesEx, or reuses the geometry retained for the current item if nothing it
+/// depends on has changed. If the plot was only panned along linear axes, the retained geometry is translated and only
+/// prims in the newly exposed region are emitted. For a horizontal pan of a SortedX item (see FindPrimsX), only the prims
+/// that can reach that region are visited; otherwise every prim is still fetched and transformed to be culled.
+/// #getter_key hashes the parameters of the renderer's getters (their Hash), and #args the renderer's own.
+template <class _Renderer, class _Getter, typename ...Args>
+void RenderPrimitivesRetained(const _Renderer& renderer, const _Getter& getter, ImGuiID getter_key, ImDrawList& draw_list, const ImRect& cull_rect, Args... args) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotItem* item = gp.CurrentItem;
+    if (item == nullptr || gp.NextItemData.DataVersion == 0) {
+        RenderPrimitivesEx(renderer, draw_list, cull_rect);
+        return;
+    }
+    const Transformer1& tx = renderer.Transformer.Tx;
+    const Transformer1& ty = renderer.Transformer.Ty;
+    // the prim count is left out since a SortedX slice changes size as the view pans (an unchanged view gives the same slice)
+    ImGuiID key = HashArgs(getter_key, &RendererTypeId<_Renderer>::Id, gp.NextItemData.DataVersion, cull_rect.Min, cull_rect.Max, draw_list.Flags);
+    key = ImHashData(&draw_list._Data->TexUvWhitePixel, sizeof(ImVec2), key);
+    key = ImHashData(draw_list._Data->TexUvLines, sizeof(draw_list._Data->TexUvLines), key);
+    key = HashTransform(tx, key);
+    key = HashTransform(ty, key);
+    key = HashArgs(key, args...);
+    const ImPlotPoint plt_min(tx.PltMin, ty.PltMin);
+    const ImPlotPoint plt_max(tx.PltMax, ty.PltMax);
+    const ImPlotPoint scale(tx.M, ty.M);
+    if (item->GeometryUsed == item->Geometry.Size)
+        item->Geometry.push_back(ImPlotGeometryCache());
+    ImPlotGeometryCache& cache = item->Geometry[item->GeometryUsed++];
+    const bool same_key = cache.Key == key;
+    if (same_key && cache.PltMin.x == plt_min.x && cache.PltMin.y == plt_min.y && cache.PltMax.x == plt_max.x && cache.PltMax.y == plt_max.y && cache.Scale.x == scale.x && cache.Scale.y == scale.y) {
+        ReplayGeometry(cache, draw_list);
+        return;
+    }
+    const int cmd0 = draw_list.CmdBuffer.Size - 1;
+    const int vtx0 = draw_list.VtxBuffer.Size;
+    const int idx0 = draw_list.IdxBuffer.Size;
+    // a pan moves everything by the same pixel offset; retranslated vertices accumulate rounding (and runs keep vertices
+    // of prims that went out of view), so rebuild once they have drifted a plot's size
+    const ImVec2 offset((float)(cache.Scale.x * (cache.PltMin.x - plt_min.x)), (float)(cache.Scale.y * (cache.PltMin.y - plt_min.y)));
+    const ImVec2 drift(cache.Drift.x + ImAbs(offset.x), cache.Drift.y + ImAbs(offset.y));
+    if (same_key && IsTranslation(tx, cache.PltMin.x, cache.PltMax.x, cache.Scale.x) && IsTranslation(ty, cache.PltMin.y, cache.PltMax.y, cache.Scale.y)
+        && drift.x <= cull_rect.GetWidth() && drift.y <= cull_rect.GetHeight())
+    {
+        ReplayGeometry(cache, draw_list, offset, cull_rect, renderer.IdxConsumed);
+        ImRect retained = cull_rect;
+        retained.Translate(offset);
+        // a horizontal pan exposes a vertical strip, whose x range bounds the prims to render
+        int first = 0, last = renderer.Prims;
+        if (offset.y == 0 && offset.x != 0) {
+            const float px0 = offset.x > 0 ? cull_rect.Min.x : cull_rect.Max.x + offset.x;
+            const float px1 = offset.x > 0 ? cull_rect.Min.x + offset.x : cull_rect.Max.x;
+            const double x0 = tx.PltMin + (px0 - tx.PixMin) / tx.M;
+            const double x1 = tx.PltMin + (px1 - tx.PixMin) / tx.M;
+            if (!FindPrimsX(getter, renderer.Prims, ImMin(x0, x1), ImMax(x0, x1), first, last)) {
+                first = 0;
+                last  = renderer.Prims;
+            }
         }
+        RenderPrimitivesEx(renderer, draw_list, CullRectExcluding(cull_rect, retained), first, last);
+        cache.Drift = drift;
     }
-    if (prims_culled > 0)
-        draw_list.PrimUnreserve(prims_culled * renderer.IdxConsumed, prims_culled * renderer.VtxConsumed);
+    else {
+        RenderPrimitivesEx(renderer, draw_list, cull_rect);
+        cache.Drift = ImVec2(0,0);
+    }
+    CaptureGeometry(cache, draw_list, cmd0, vtx0, idx0);
+    cache.Key    = key;
+    cache.PltMin = plt_min;
+    cache.PltMax = plt_max;
+    cache.Scale  = scale;
 }
 
 template <template <class> class _Renderer, class _Getter, typename ...Args>
 void RenderPrimitives1(const _Getter& getter, Args... args) {
     ImDrawList& draw_list = *GetPlotDrawList();
     const ImRect& cull_rect = GetCurrentPlot()->PlotRect;
-    RenderPrimitivesEx(_Renderer<_Getter>(getter,args...), draw_list, cull_rect);
+    RenderPrimitivesRetained(_Renderer<_Getter>(getter,args...), getter, getter.Hash(0), draw_list, cull_rect, args...);
 }
 
 template <template <class,class> class _Renderer, class _Getter1, class _Getter2, typename ...Args>
 void RenderPrimitives2(const _Getter1& getter1, const _Getter2& getter2, Args... args) {
     ImDrawList& draw_list = *GetPlotDrawList();
     const ImRect& cull_rect = GetCurrentPlot()->PlotRect;
-    RenderPrimitivesEx(_Renderer<_Getter1,_Getter2>(getter1,getter2,args...), draw_list, cull_rect);
+    RenderPrimitivesRetained(_Renderer<_Getter1,_Getter2>(getter1,getter2,args...), getter1, getter2.Hash(getter1.Hash(0)), draw_list, cull_rect, args...);
 }
 
 //-----------------------------------------------------------------------------
@@ -1419,6 +3163,7 @@ struct RendererMarkersFill : RendererBase {
     RendererMarkersFill(const _Getter& getter, const ImVec2* marker, int count, float size, ImU32 col) :
         RendererBase(getter.Count, (count-2)*3, count),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Marker(marker),
         Count(count),
         Size(size),
@@ -1427,9 +3172,10 @@ struct RendererMarkersFill : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
-        if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 p = Pixels(prim);
+        if (CullContains(cull_rect, p)) {
             for (int i = 0; i < Count; i++) {
                 draw_list._VtxWritePtr[0].pos.x = p.x + Marker[i].x * Size;
                 draw_list._VtxWritePtr[0].pos.y = p.y + Marker[i].y * Size;
@@ -1449,6 +3195,7 @@ struct RendererMarkersFill : RendererBase {
         return false;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImVec2* Marker;
     const int Count;
     const float Size;
@@ -1462,6 +3209,7 @@ struct RendererMarkersLine : RendererBase {
     RendererMarkersLine(const _Getter& getter, const ImVec2* marker, int count, float size, float weight, ImU32 col) :
         RendererBase(getter.Count, count/2*6, count/2*4),
         Getter(getter),
+        Pixels(getter, this->Transformer),
         Marker(marker),
         Count(count),
         HalfWeight(ImMax(1.0f,weight)*0.5f),
@@ -1471,9 +3219,10 @@ struct RendererMarkersLine : RendererBase {
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
-        if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 p = Pixels(prim);
+        if (CullContains(cull_rect, p)) {
             for (int i = 0; i < Count; i = i + 2) {
                 ImVec2 p1(p.x + Marker[i].x * Size, p.y + Marker[i].y * Size);
                 ImVec2 p2(p.x + Marker[i+1].x * Size, p.y + Marker[i+1].y * Size);
@@ -1484,6 +3233,7 @@ struct RendererMarkersLine : RendererBase {
         return false;
     }
     const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
     const ImVec2* Marker;
     const int Count;
     mutable float HalfWeight;
@@ -1493,6 +3243,35 @@ struct RendererMarkersLine : RendererBase {
     mutable ImVec2 UV1;
 };
 
+template <class _Getter>
+struct RendererMarkersSprite : RendererBase {
+    RendererMarkersSprite(const _Getter& getter, float half_size, ImVec2 uv0, ImVec2 uv1, ImU32 col) :
+        RendererBase(getter.Count, 6, 4),
+        Getter(getter),
+        Pixels(getter, this->Transformer),
+        HalfSize(half_size, half_size),
+        UV0(uv0),
+        UV1(uv1),
+        Col(col)
+    { }
+    void Init(ImDrawList&) const { }
+    template <class _Cull>
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const _Cull& cull_rect, int prim) const {
+        ImVec2 p = Pixels(prim);
+        if (CullContains(cull_rect, p)) {
+            PrimRectUV(draw_list, p - HalfSize, p + HalfSize, UV0, UV1, Col);
+            return true;
+        }
+        return false;
+    }
+    const _Getter& Getter;
+    const TransformCache<_Getter> Pixels;
+    const ImVec2 HalfSize;
+    const ImVec2 UV0;
+    const ImVec2 UV1;
+    const ImU32 Col;
+};
+
 static const ImVec2 MARKER_FILL_CIRCLE[10]  = {ImVec2(1.0f, 0.0f), ImVec2(0.809017f, 0.58778524f),ImVec2(0.30901697f, 0.95105654f),ImVec2(-0.30901703f, 0.9510565f),ImVec2(-0.80901706f, 0.5877852f),ImVec2(-1.0f, 0.0f),ImVec2(-0.80901694f, -0.58778536f),ImVec2(-0.3090171f, -0.9510565f),ImVec2(0.30901712f, -0.9510565f),ImVec2(0.80901694f, -0.5877853f)};
 static const ImVec2 MARKER_FILL_SQUARE[4]   = {ImVec2(SQRT_1_2,SQRT_1_2), ImVec2(SQRT_1_2,-SQRT_1_2), ImVec2(-SQRT_1_2,-SQRT_1_2), ImVec2(-SQRT_1_2,SQRT_1_2)};
 static const ImVec2 MARKER_FILL_DIAMOND[4]  = {ImVec2(1, 0), ImVec2(0, -1), ImVec2(-1, 0), ImVec2(0, 1)};
@@ -1533,8 +3312,161 @@ static const ImVec2 MARKER_LINE_ASTERISK[6] = {ImVec2(-SQRT_3_2, -0.5f), ImVec2(
 static const ImVec2 MARKER_LINE_PLUS[4]     = {ImVec2(-1, 0), ImVec2(1, 0), ImVec2(0, -1), ImVec2(0, 1)};
 static const ImVec2 MARKER_LINE_CROSS[4]    = {ImVec2(-SQRT_1_2,-SQRT_1_2),ImVec2(SQRT_1_2,SQRT_1_2),ImVec2(SQRT_1_2,-SQRT_1_2),ImVec2(-SQRT_1_2,SQRT_1_2)};
 
+// Fill and outline shapes indexed by ImPlotMarker, used to rasterize the marker atlas
+static const ImVec2* const MARKER_FILL_SHAPES[ImPlotMarker_COUNT] = {MARKER_FILL_CIRCLE, MARKER_FILL_SQUARE, MARKER_FILL_DIAMOND, MARKER_FILL_UP, MARKER_FILL_DOWN, MARKER_FILL_LEFT, MARKER_FILL_RIGHT, nullptr, nullptr, nullptr};
+static const int MARKER_FILL_COUNTS[ImPlotMarker_COUNT]          = {10, 4, 4, 3, 3, 3, 3, 0, 0, 0};
+static const ImVec2* const MARKER_LINE_SHAPES[ImPlotMarker_COUNT] = {MARKER_LINE_CIRCLE, MARKER_LINE_SQUARE, MARKER_LINE_DIAMOND, MARKER_LINE_UP, MARKER_LINE_DOWN, MARKER_LINE_LEFT, MARKER_LINE_RIGHT, MARKER_LINE_CROSS, MARKER_LINE_PLUS, MARKER_LINE_ASTERISK};
+static const int MARKER_LINE_COUNTS[ImPlotMarker_COUNT]          = {20, 8, 8, 6, 6, 6, 6, 4, 4, 6};
+
+static const int MARKER_ATLAS_PAGE_SIZE = 512;
+static const int MARKER_ATLAS_MAX_PAGES = 8;
+static const int MARKER_ATLAS_SAMPLES   = 4; // supersampling per axis
+
+// Reserves a w x w region of the last atlas page for a new sprite, starting a new page if it doesn't fit. Returns
+// the sprite's index, or -1 if the atlas is full.
+static int AddMarkerSprite(ImPlotMarkerAtlas& atlas, ImGuiID key, int w) {
+    if (w + 2 > MARKER_ATLAS_PAGE_SIZE)
+        return -1;
+    ImPlotMarkerAtlasPage* page = atlas.Pages.empty() ? nullptr : &atlas.Pages.back();
+    if (page != nullptr && page->ShelfX + w + 2 > MARKER_ATLAS_PAGE_SIZE) {
+        page->ShelfX      = 0;
+        page->ShelfY     += page->ShelfHeight;
+        page->ShelfHeight = 0;
+    }
+    if (page == nullptr || page->ShelfY + w + 2 > MARKER_ATLAS_PAGE_SIZE) {
+        if (atlas.Pages.Size == MARKER_ATLAS_MAX_PAGES)
+            return -1;
+        atlas.Pages.push_back(ImPlotMarkerAtlasPage());
+        page = &atlas.Pages.back();
+        page->Pixels.resize(MARKER_ATLAS_PAGE_SIZE * MARKER_ATLAS_PAGE_SIZE);
+        for (int i = 0; i < page->Pixels.Size; ++i)
+            page->Pixels[i] = IM_COL32(255,255,255,0);
+    }
+    ImPlotMarkerSprite sprite;
+    sprite.Key   = key;
+    sprite.Page  = atlas.Pages.Size - 1;
+    sprite.X     = page->ShelfX + 1;
+    sprite.Y     = page->ShelfY + 1;
+    sprite.Width = w;
+    page->ShelfX      += w + 1;
+    page->ShelfHeight  = ImMax(page->ShelfHeight, w + 1);
+    page->Dirty        = true;
+    atlas.Sprites.push_back(sprite);
+    atlas.SpriteMap.SetInt(key, atlas.Sprites.Size);
+    return atlas.Sprites.Size - 1;
+}
+
+// Returns the coverage [0,1] of the pixel at (x,y) of a sprite w pixels wide by a marker's convex fill polygon, or by its
+// outline segments stroked with round caps of half_weight
+static float MarkerCoverage(const ImVec2* shape, int count, bool outline, float size, float half_weight, int w, int x, int y) {
+    const float c = w * 0.5f;
+    int hits = 0;
+    for (int sy = 0; sy < MARKER_ATLAS_SAMPLES; ++sy) {
+        for (int sx = 0; sx < MARKER_ATLAS_SAMPLES; ++sx) {
+            const ImVec2 q(x + (sx + 0.5f) / MARKER_ATLAS_SAMPLES - c, y + (sy + 0.5f) / MARKER_ATLAS_SAMPLES - c);
+            if (outline) {
+                for (int i = 0; i < count; i += 2) {
+                    const ImVec2 a = shape[i] * size;
+                    const ImVec2 ab = shape[i+1] * size - a;
+                    const ImVec2 aq = q - a;
+                    const float len2 = ab.x * ab.x + ab.y * ab.y;
+                    const float t = len2 > 0 ? ImClamp((aq.x * ab.x + aq.y * ab.y) / len2, 0.0f, 1.0f) : 0.0f;
+                    const ImVec2 d = aq - ab * t;
+                    if (d.x * d.x + d.y * d.y <= half_weight * half_weight) {
+                        hits++;
+                        break;
+                    }
+                }
+            }
+            else {
+                // inside if on the same side of every edge (the shapes are wound either way)
+                int pos = 0, neg = 0;
+                for (int i = 0; i < count; ++i) {
+                    const ImVec2 a = shape[i] * size;
+                    const ImVec2 b = shape[(i + 1) % count] * size;
+                    const float cross = (b.x - a.x) * (q.y - a.y) - (b.y - a.y) * (q.x - a.x);
+                    pos += cross >= 0;
+                    neg += cross <= 0;
+                }
+                hits += (pos == count || neg == count);
+            }
+        }
+    }
+    return (float)hits / (MARKER_ATLAS_SAMPLES * MARKER_ATLAS_SAMPLES);
+}
+
+// Returns the index of the atlas sprite for a marker fill or outline, rasterizing it if needed. Returns -1 on failure.
+static int GetMarkerSprite(ImPlotMarker marker, bool outline, float size, float weight) {
+    ImPlotMarkerAtlas& atlas = GImPlot->MarkerAtlas;
+    // quantize to quarter pixels so that animated or highlighted sizes don't flood the atlas
+    const float size_q   = ImMax(1.0f, ImFloor(size * 4 + 0.5f) * 0.25f);
+    const float weight_q = outline ? ImFloor(weight * 4 + 0.5f) * 0.25f : 0.0f;
+    const float key_data[4] = {(float)marker, outline ? 1.0f : 0.0f, size_q, weight_q};
+    const ImGuiID key = ImHashData(key_data, sizeof(key_data));
+    const int found = atlas.SpriteMap.GetInt(key, 0);
+    if (found > 0)
+        return found - 1;
+    const ImVec2* shape = outline ? MARKER_LINE_SHAPES[marker] : MARKER_FILL_SHAPES[marker];
+    const int     count = outline ? MARKER_LINE_COUNTS[marker] : MARKER_FILL_COUNTS[marker];
+    const float half_weight = outline ? ImMax(1.0f, weight_q) * 0.5f : 0.0f;
+    // one pixel of margin for the antialiased edge
+    const int w = 2 * (int)ImCeil(size_q + half_weight + 1);
+    const int idx = AddMarkerSprite(atlas, key, w);
+    if (idx < 0)
+        return -1;
+    const ImPlotMarkerSprite& sprite = atlas.Sprites[idx];
+    ImPlotMarkerAtlasPage& page = atlas.Pages[sprite.Page];
+    for (int y = 0; y < w; ++y) {
+        for (int x = 0; x < w; ++x) {
+            const float coverage = MarkerCoverage(shape, count, outline, size_q, half_weight, w, x, y);
+            page.Pixels[(sprite.Y + y) * MARKER_ATLAS_PAGE_SIZE + sprite.X + x] = IM_COL32(255, 255, 255, (int)(coverage * 255 + 0.5f));
+        }
+    }
+    return idx;
+}
+
+template <typename _Getter>
+void RenderMarkerSprite(const _Getter& getter, int sprite_idx, ImU32 col) {
+    const ImPlotMarkerAtlas& atlas = GImPlot->MarkerAtlas;
+    const ImPlotMarkerSprite& sprite = atlas.Sprites[sprite_idx];
+    const float inv_size = 1.0f / MARKER_ATLAS_PAGE_SIZE;
+    const ImVec2 uv0(sprite.X * inv_size, sprite.Y * inv_size);
+    const ImVec2 uv1((sprite.X + sprite.Width) * inv_size, (sprite.Y + sprite.Width) * inv_size);
+    ImDrawList& draw_list = *GetPlotDrawList();
+    draw_list.PushTextureID(atlas.Pages[sprite.Page].TexID);
+    RenderPrimitives1<RendererMarkersSprite>(getter, sprite.Width * 0.5f, uv0, uv1, col);
+    draw_list.PopTextureID();
+}
+
+// Renders markers as one textured quad each from the marker atlas. Returns false if they couldn't be rasterized.
+template <typename _Getter>
+bool RenderMarkerSprites(const _Getter& getter, ImPlotMarker marker, float size, bool rend_fill, ImU32 col_fill, bool rend_line, ImU32 col_line, float weight) {
+    ImPlotMarkerAtlas& atlas = GImPlot->MarkerAtlas;
+    if (marker < 0 || marker >= ImPlotMarker_COUNT)
+        return false;
+    rend_fill = rend_fill && MARKER_FILL_SHAPES[marker] != nullptr;
+    const int fill = rend_fill ? GetMarkerSprite(marker, false, size, weight) : -1;
+    const int line = rend_line ? GetMarkerSprite(marker, true, size, weight) : -1;
+    if ((rend_fill && fill < 0) || (rend_line && line < 0))
+        return false;
+    for (int i = 0; i < atlas.Pages.Size; ++i) {
+        ImPlotMarkerAtlasPage& page = atlas.Pages[i];
+        if (page.Dirty) {
+            page.TexID = atlas.Callback((const unsigned char*)page.Pixels.Data, MARKER_ATLAS_PAGE_SIZE, MARKER_ATLAS_PAGE_SIZE, page.TexID, atlas.CallbackData);
+            page.Dirty = false;
+        }
+    }
+    if (rend_fill)
+        RenderMarkerSprite(getter, fill, col_fill);
+    if (rend_line)
+        RenderMarkerSprite(getter, line, col_line);
+    return true;
+}
+
 template <typename _Getter>
 void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool rend_fill, ImU32 col_fill, bool rend_line, ImU32 col_line, float weight) {
+    if (GImPlot->MarkerAtlas.Callback != nullptr && RenderMarkerSprites(getter, marker, size, rend_fill, col_fill, rend_line, col_line, weight))
+        return;
     if (rend_fill) {
         switch (marker) {
             case ImPlotMarker_Circle  : RenderPrimitives1<RendererMarkersFill>(getter,MARKER_FILL_CIRCLE,10,size,col_fill); break;
@@ -1562,10 +3494,60 @@ void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool
     }
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] PlotLine
-//-----------------------------------------------------------------------------
-
+//-----------------------------------------------------------------------------
+// [SECTION] PlotLine
+//-----------------------------------------------------------------------------
+
+template <typename _Getter>
+void RenderLineEx(const _Getter& getter, ImPlotLineFlags flags) {
+    const ImPlotNextItemData& s = GetItemData();
+    if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+        GetterOverrideY<_Getter> getter2(getter, 0);
+        RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
+    }
+    if (s.RenderLine) {
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+        if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
+            RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
+        }
+        else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+            if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+            else
+                RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+        }
+        else {
+            if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
+            else
+                RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
+        }
+    }
+}
+
+template <typename _Getter>
+void RenderLineItem(const _Getter& getter, ImPlotLineFlags flags) {
+    const ImPlotNextItemData& s = GetItemData();
+    if (getter.Count > 1) {
+        // segments are independent, so they can't be folded into columns
+        if (ImHasFlag(flags, ImPlotLineFlags_Decimate) && !ImHasFlag(flags, ImPlotLineFlags_Segments))
+            RenderLineEx(GetterM4<_Getter>(getter, GImPlot->TempPoint1), flags);
+        else
+            RenderLineEx(getter, flags);
+    }
+    // render markers
+    if (s.Marker != ImPlotMarker_None) {
+        if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
+            PopPlotClipRect();
+            PushPlotClipRect(s.MarkerSize);
+        }
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
+        RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+    }
+}
+
 template <typename _Getter>
 void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
     if (BeginItemEx(label_id, Fitter1<_Getter>(getter), flags, ImPlotCol_Line)) {
@@ -1574,41 +3556,21 @@ void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags fla
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
-        if (getter.Count > 1) {
-            if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-                GetterOverrideY<_Getter> getter2(getter, 0);
-                RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
-            }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-                if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
-                    RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
-                }
-                else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                }
-                else {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
-                }
-            }
-        }
-        // render markers
-        if (s.Marker != ImPlotMarker_None) {
-            if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
-                PopPlotClipRect();
-                PushPlotClipRect(s.MarkerSize);
+        // LTTB keeps single points, not the point pairs that segments are made of
+        if (s.DownsamplePoints != 0 && !ImHasFlag(flags, ImPlotLineFlags_Segments))
+            RenderLineItem(GetterLTTB<_Getter>(getter, GImPlot->TempPoint2, s.DownsamplePoints), flags);
+        else if (ImHasFlag(flags, ImPlotItemFlags_SortedX) && !ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+            int first, last;
+            GetVisibleRangeX(getter, first, last);
+            // segments are drawn between points 2i and 2i+1, so the slice must start and end on a pair boundary
+            if (ImHasFlag(flags, ImPlotLineFlags_Segments)) {
+                first &= ~1;
+                last   = ImMin(last | 1, getter.Count - 1);
             }
-            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
-            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+            RenderLineItem(GetterSlice<_Getter>(getter, first, last - first + 1), flags);
         }
+        else
+            RenderLineItem(getter, flags);
         EndItem();
     }
 }
@@ -1641,6 +3603,102 @@ void PlotLineG(const char* label_id, ImPlotGetter getter_func, void* data, int c
 // [SECTION] PlotScatter
 //-----------------------------------------------------------------------------
 
+/// Bins the points of a getter into square pixel cells covering the plot area and yields one colormapped rect per cell.
+/// Empty cells are transparent. Counts are colored on a log scale so that sparse regions remain visible next to dense ones.
+template <typename _Getter>
+struct GetterDensity {
+    GetterDensity(const _Getter& getter, float cell_size, ImVector<int>& counts, ImVector<double>& edges) :
+        Counts(counts),
+        Edges(edges),
+        Cols(0),
+        Rows(0),
+        InvLogMax(0),
+        Count(Accumulate(getter, cell_size))
+    { }
+    template <typename I> IMPLOT_INLINE RectC operator()(I idx) const {
+        const int r = idx / Cols;
+        const int c = idx % Cols;
+        const double* ex = Edges.Data + c;
+        const double* ey = Edges.Data + Cols + 1 + r;
+        RectC rect;
+        rect.Pos      = ImPlotPoint((ex[0] + ex[1]) * 0.5, (ey[0] + ey[1]) * 0.5);
+        rect.HalfSize = ImPlotPoint((ex[1] - ex[0]) * 0.5, (ey[1] - ey[0]) * 0.5);
+        const int n = Counts.Data[idx];
+        if (n == 0) {
+            rect.Color = 0;
+            return rect;
+        }
+        const float t = ImClamp((float)(log((double)n) * InvLogMax), 0.0f, 1.0f);
+        ImPlotContext& gp = *GImPlot;
+        rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
+        return rect;
+    }
+    int Accumulate(const _Getter& getter, float cell_size) {
+        const ImPlotPlot& plot = *GetCurrentPlot();
+        const ImRect& plot_rect = plot.PlotRect;
+        Cols = ImMax(1, (int)ceil(plot_rect.GetWidth()  / cell_size));
+        Rows = ImMax(1, (int)ceil(plot_rect.GetHeight() / cell_size));
+        Counts.resize(Cols * Rows);
+        memset(Counts.Data, 0, Counts.Size * sizeof(int));
+        const TransformCache<_Getter> pixels(getter, Transformer2(plot));
+        const float inv_cell = 1.0f / cell_size;
+        int max_count = 0;
+        for (int i = 0; i < getter.Count; ++i) {
+            const ImVec2 P = pixels(i);
+            const float cx = (P.x - plot_rect.Min.x) * inv_cell;
+            const float cy = (P.y - plot_rect.Min.y) * inv_cell;
+            // written so that NaNs are rejected too
+            if (!(cx >= 0 && cx < Cols && cy >= 0 && cy < Rows))
+                continue;
+            int& n = Counts.Data[(int)cy * Cols + (int)cx];
+            max_count = ImMax(max_count, ++n);
+        }
+        if (max_count == 0)
+            return 0;
+        InvLogMax = max_count > 1 ? 1.0 / log((double)max_count) : 0.0;
+        // cell edges are inverse transformed so that non-linear scales line up with the pixel grid
+        const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+        const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+        Edges.resize(Cols + Rows + 2);
+        for (int c = 0; c <= Cols; ++c)
+            Edges.Data[c] = x_axis.PixelsToPlot(plot_rect.Min.x + c * cell_size);
+        for (int r = 0; r <= Rows; ++r)
+            Edges.Data[Cols + 1 + r] = y_axis.PixelsToPlot(plot_rect.Min.y + r * cell_size);
+        return Cols * Rows;
+    }
+    ImVector<int>& Counts;
+    ImVector<double>& Edges;
+    int Cols, Rows;
+    double InvLogMax;
+    const int Count;
+};
+
+template <typename Getter>
+void RenderScatterDensity(const Getter& getter) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotNextItemData& s = GetItemData();
+    // one cell per marker radius keeps the raster legible and its vertex count proportional to the plot area
+    const float cell_size = ImMax(1.0f, (float)(int)s.MarkerSize);
+    GetterDensity<Getter> density(getter, cell_size, gp.TempInt1, gp.TempDouble1);
+    // the grid is anchored to the plot area rather than the data, so it is never retained across frames
+    RenderPrimitivesEx(RendererRectC<GetterDensity<Getter>>(density), *GetPlotDrawList(), GetCurrentPlot()->PlotRect);
+}
+
+template <typename Getter>
+void RenderScatterItem(const Getter& getter, ImPlotScatterFlags flags) {
+    const ImPlotNextItemData& s = GetItemData();
+    ImPlotMarker marker = s.Marker == ImPlotMarker_None ? ImPlotMarker_Circle: s.Marker;
+    if (marker != ImPlotMarker_None) {
+        if (ImHasFlag(flags,ImPlotScatterFlags_NoClip)) {
+            PopPlotClipRect();
+            PushPlotClipRect(s.MarkerSize);
+        }
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
+        RenderMarkers<Getter>(getter, marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+    }
+}
+
 template <typename Getter>
 void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlags flags) {
     if (BeginItemEx(label_id, Fitter1<Getter>(getter), flags, ImPlotCol_MarkerOutline)) {
@@ -1649,16 +3707,17 @@ void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlag
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
-        ImPlotMarker marker = s.Marker == ImPlotMarker_None ? ImPlotMarker_Circle: s.Marker;
-        if (marker != ImPlotMarker_None) {
-            if (ImHasFlag(flags,ImPlotScatterFlags_NoClip)) {
-                PopPlotClipRect();
-                PushPlotClipRect(s.MarkerSize);
-            }
-            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
-            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<Getter>(getter, marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+        if (ImHasFlag(flags, ImPlotScatterFlags_Density))
+            RenderScatterDensity(getter);
+        else if (s.DownsamplePoints != 0)
+            RenderScatterItem(GetterLTTB<Getter>(getter, GImPlot->TempPoint2, s.DownsamplePoints), flags);
+        else if (ImHasFlag(flags, ImPlotItemFlags_SortedX)) {
+            int first, last;
+            GetVisibleRangeX(getter, first, last);
+            RenderScatterItem(GetterSlice<Getter>(getter, first, last - first + 1), flags);
         }
+        else
+            RenderScatterItem(getter, flags);
         EndItem();
     }
 }
@@ -1691,6 +3750,35 @@ void PlotScatterG(const char* label_id, ImPlotGetter getter_func, void* data, in
 // [SECTION] PlotStairs
 //-----------------------------------------------------------------------------
 
+template <typename Getter>
+void RenderStairsItem(const Getter& getter, ImPlotStairsFlags flags) {
+    const ImPlotNextItemData& s = GetItemData();
+    if (getter.Count > 1) {
+        if (s.RenderFill && ImHasFlag(flags,ImPlotStairsFlags_Shaded)) {
+            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+            if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
+                RenderPrimitives1<RendererStairsPreShaded>(getter,col_fill);
+            else
+                RenderPrimitives1<RendererStairsPostShaded>(getter,col_fill);
+        }
+        if (s.RenderLine) {
+            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+            if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
+                RenderPrimitives1<RendererStairsPre>(getter,col_line,s.LineWeight);
+            else
+                RenderPrimitives1<RendererStairsPost>(getter,col_line,s.LineWeight);
+        }
+    }
+    // render markers
+    if (s.Marker != ImPlotMarker_None) {
+        PopPlotClipRect();
+        PushPlotClipRect(s.MarkerSize);
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
+        RenderMarkers<Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+    }
+}
+
 template <typename Getter>
 void PlotStairsEx(const char* label_id, const Getter& getter, ImPlotStairsFlags flags) {
     if (BeginItemEx(label_id, Fitter1<Getter>(getter), flags, ImPlotCol_Line)) {
@@ -1699,30 +3787,15 @@ void PlotStairsEx(const char* label_id, const Getter& getter, ImPlotStairsFlags
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
-        if (getter.Count > 1) {
-            if (s.RenderFill && ImHasFlag(flags,ImPlotStairsFlags_Shaded)) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-                if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
-                    RenderPrimitives1<RendererStairsPreShaded>(getter,col_fill);
-                else
-                    RenderPrimitives1<RendererStairsPostShaded>(getter,col_fill);
-            }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-                if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
-                    RenderPrimitives1<RendererStairsPre>(getter,col_line,s.LineWeight);
-                else
-                    RenderPrimitives1<RendererStairsPost>(getter,col_line,s.LineWeight);
-            }
-        }
-        // render markers
-        if (s.Marker != ImPlotMarker_None) {
-            PopPlotClipRect();
-            PushPlotClipRect(s.MarkerSize);
-            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
-            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+        if (s.DownsamplePoints != 0)
+            RenderStairsItem(GetterLTTB<Getter>(getter, GImPlot->TempPoint2, s.DownsamplePoints), flags);
+        else if (ImHasFlag(flags, ImPlotItemFlags_SortedX)) {
+            int first, last;
+            GetVisibleRangeX(getter, first, last);
+            RenderStairsItem(GetterSlice<Getter>(getter, first, last - first + 1), flags);
         }
+        else
+            RenderStairsItem(getter, flags);
         EndItem();
     }
 }
@@ -1765,7 +3838,18 @@ void PlotShadedEx(const char* label_id, const Getter1& getter1, const Getter2& g
         const ImPlotNextItemData& s = GetItemData();
         if (s.RenderFill) {
             const ImU32 col = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-            RenderPrimitives2<RendererShaded>(getter1,getter2,col);
+            if (ImHasFlag(flags, ImPlotItemFlags_SortedX)) {
+                // both bounds share the prim index, so take the union of their visible ranges
+                int first1, last1, first2, last2;
+                GetVisibleRangeX(getter1, first1, last1);
+                GetVisibleRangeX(getter2, first2, last2);
+                const int first = ImMin(first1, first2);
+                const int count = ImMax(last1, last2) - first + 1;
+                RenderPrimitives2<RendererShaded>(GetterSlice<Getter1>(getter1, first, ImMin(count, getter1.Count - first)),
+                                                  GetterSlice<Getter2>(getter2, first, ImMin(count, getter2.Count - first)), col);
+            }
+            else
+                RenderPrimitives2<RendererShaded>(getter1,getter2,col);
         }
         EndItem();
     }
@@ -2011,19 +4095,9 @@ void PlotErrorBarsVEx(const char* label_id, const _GetterPos& getter_pos, const
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
-        ImDrawList& draw_list = *GetPlotDrawList();
         const ImU32 col = ImGui::GetColorU32(s.Colors[ImPlotCol_ErrorBar]);
-        const bool rend_whisker  = s.ErrorBarSize > 0;
-        const float half_whisker = s.ErrorBarSize * 0.5f;
-        for (int i = 0; i < getter_pos.Count; ++i) {
-            ImVec2 p1 = PlotToPixels(getter_neg(i),IMPLOT_AUTO,IMPLOT_AUTO);
-            ImVec2 p2 = PlotToPixels(getter_pos(i),IMPLOT_AUTO,IMPLOT_AUTO);
-            draw_list.AddLine(p1,p2,col, s.ErrorBarWeight);
-            if (rend_whisker) {
-                draw_list.AddLine(p1 - ImVec2(half_whisker, 0), p1 + ImVec2(half_whisker, 0), col, s.ErrorBarWeight);
-                draw_list.AddLine(p2 - ImVec2(half_whisker, 0), p2 + ImVec2(half_whisker, 0), col, s.ErrorBarWeight);
-            }
-        }
+        const ImVec2 whisker = s.ErrorBarSize > 0 ? ImVec2(s.ErrorBarSize * 0.5f, 0) : ImVec2(0, 0);
+        RenderPrimitives2<RendererErrorBars>(getter_neg, getter_pos, col, s.ErrorBarWeight, whisker);
         EndItem();
     }
 }
@@ -2036,19 +4110,9 @@ void PlotErrorBarsHEx(const char* label_id, const _GetterPos& getter_pos, const
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
-        ImDrawList& draw_list = *GetPlotDrawList();
         const ImU32 col = ImGui::GetColorU32(s.Colors[ImPlotCol_ErrorBar]);
-        const bool rend_whisker  = s.ErrorBarSize > 0;
-        const float half_whisker = s.ErrorBarSize * 0.5f;
-        for (int i = 0; i < getter_pos.Count; ++i) {
-            ImVec2 p1 = PlotToPixels(getter_neg(i),IMPLOT_AUTO,IMPLOT_AUTO);
-            ImVec2 p2 = PlotToPixels(getter_pos(i),IMPLOT_AUTO,IMPLOT_AUTO);
-            draw_list.AddLine(p1, p2, col, s.ErrorBarWeight);
-            if (rend_whisker) {
-                draw_list.AddLine(p1 - ImVec2(0, half_whisker), p1 + ImVec2(0, half_whisker), col, s.ErrorBarWeight);
-                draw_list.AddLine(p2 - ImVec2(0, half_whisker), p2 + ImVec2(0, half_whisker), col, s.ErrorBarWeight);
-            }
-        }
+        const ImVec2 whisker = s.ErrorBarSize > 0 ? ImVec2(0, s.ErrorBarSize * 0.5f) : ImVec2(0, 0);
+        RenderPrimitives2<RendererErrorBars>(getter_neg, getter_pos, col, s.ErrorBarWeight, whisker);
         EndItem();
     }
 }
@@ -2064,7 +4128,6 @@ void PlotErrorBars(const char* label_id, const T* xs, const T* ys, const T* neg,
     IndexerIdx<T> indexer_y(ys, count,offset,stride);
     IndexerIdx<T> indexer_n(neg,count,offset,stride);
     IndexerIdx<T> indexer_p(pos,count,offset,stride);
-    GetterError<T> getter(xs, ys, neg, pos, count, offset, stride);
     if (ImHasFlag(flags, ImPlotErrorBarsFlags_Horizontal)) {
         IndexerAdd<IndexerIdx<T>,IndexerIdx<T>> indexer_xp(indexer_x, indexer_p, 1,  1);
         IndexerAdd<IndexerIdx<T>,IndexerIdx<T>> indexer_xn(indexer_x, indexer_n, 1, -1);
@@ -2338,11 +4401,39 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotHeatmap
 //-----------------------------------------------------------------------------
 
+/// Rows [RowMin,RowMax) and columns [ColMin,ColMax) of a heatmap that fall within the current plot's axis ranges.
+/// Cell (r,c) spans x in xref + [c,c+1]*width and y in yref + ydir*[r,r+1]*height.
+struct HeatmapWindow {
+    HeatmapWindow(int rows, int cols, double width, double height, double xref, double yref, double ydir) {
+        const ImPlotPlot& plot = *GetCurrentPlot();
+        Visible(plot.Axes[plot.CurrentX].Range, xref, width, cols, ColMin, ColMax);
+        Visible(plot.Axes[plot.CurrentY].Range, yref, ydir * height, rows, RowMin, RowMax);
+    }
+    static void Visible(const ImPlotRange& range, double ref, double size, int count, int& first, int& last) {
+        first = 0;
+        last  = count;
+        if (size == 0)
+            return;
+        double a = (range.Min - ref) / size;
+        double b = (range.Max - ref) / size;
+        if (a > b)
+            ImSwap(a, b);
+        // written so that NaNs leave the full range
+        if (a > 0)
+            first = a < count ? (int)a : count;
+        if (b < count)
+            last = b > first ? ImMin((int)ceil(b), count) : first;
+    }
+    int Rows() const { return RowMax - RowMin; }
+    int Cols() const { return ColMax - ColMin; }
+    int RowMin, RowMax, ColMin, ColMax;
+};
+
 template <typename T>
 struct GetterHeatmapRowMaj {
-    GetterHeatmapRowMaj(const T* values, int rows, int cols, double scale_min, double scale_max, double width, double height, double xref, double yref, double ydir) :
+    GetterHeatmapRowMaj(const T* values, int rows, int cols, double scale_min, double scale_max, double width, double height, double xref, double yref, double ydir, const HeatmapWindow& window) :
         Values(values),
-        Count(rows*cols),
+        Count(window.Rows()*window.Cols()),
         Rows(rows),
         Cols(cols),
         ScaleMin(scale_min),
@@ -2352,12 +4443,13 @@ struct GetterHeatmapRowMaj {
         XRef(xref),
         YRef(yref),
         YDir(ydir),
-        HalfSize(Width*0.5, Height*0.5)
+        HalfSize(Width*0.5, Height*0.5),
+        Window(window)
     { }
     template <typename I> IMPLOT_INLINE RectC operator()(I idx) const {
-        double val = (double)Values[idx];
-        const int r = idx / Cols;
-        const int c = idx % Cols;
+        const int r = Window.RowMin + idx / Window.Cols();
+        const int c = Window.ColMin + idx % Window.Cols();
+        double val = (double)Values[r*Cols + c];
         const ImPlotPoint p(XRef + HalfSize.x + c*Width, YRef + YDir * (HalfSize.y + r*Height));
         RectC rect;
         rect.Pos = p;
@@ -2367,17 +4459,20 @@ struct GetterHeatmapRowMaj {
         rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
         return rect;
     }
+    // the window is left out, since it follows the view (see HeatmapWindow)
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, Values, Rows, Cols, ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir, GImPlot->Style.Colormap); }
     const T* const Values;
     const int Count, Rows, Cols;
     const double ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir;
     const ImPlotPoint HalfSize;
+    const HeatmapWindow Window;
 };
 
 template <typename T>
 struct GetterHeatmapColMaj {
-    GetterHeatmapColMaj(const T* values, int rows, int cols, double scale_min, double scale_max, double width, double height, double xref, double yref, double ydir) :
+    GetterHeatmapColMaj(const T* values, int rows, int cols, double scale_min, double scale_max, double width, double height, double xref, double yref, double ydir, const HeatmapWindow& window) :
         Values(values),
-        Count(rows*cols),
+        Count(window.Rows()*window.Cols()),
         Rows(rows),
         Cols(cols),
         ScaleMin(scale_min),
@@ -2387,12 +4482,13 @@ struct GetterHeatmapColMaj {
         XRef(xref),
         YRef(yref),
         YDir(ydir),
-        HalfSize(Width*0.5, Height*0.5)
+        HalfSize(Width*0.5, Height*0.5),
+        Window(window)
     { }
     template <typename I> IMPLOT_INLINE RectC operator()(I idx) const {
-        double val = (double)Values[idx];
-        const int r = idx % Rows;
-        const int c = idx / Rows;
+        const int r = Window.RowMin + idx % Window.Rows();
+        const int c = Window.ColMin + idx / Window.Rows();
+        double val = (double)Values[c*Rows + r];
         const ImPlotPoint p(XRef + HalfSize.x + c*Width, YRef + YDir * (HalfSize.y + r*Height));
         RectC rect;
         rect.Pos = p;
@@ -2402,12 +4498,50 @@ struct GetterHeatmapColMaj {
         rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
         return rect;
     }
+    // the window is left out, since it follows the view (see HeatmapWindow)
+    ImGuiID Hash(ImGuiID seed) const { return HashArgs(seed, Values, Rows, Cols, ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir, GImPlot->Style.Colormap); }
     const T* const Values;
     const int Count, Rows, Cols;
     const double ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir;
     const ImPlotPoint HalfSize;
+    const HeatmapWindow Window;
 };
 
+// Most labels an item keeps formatted across frames (see RenderHeatmap)
+static const int HEATMAP_LABEL_CACHE_SIZE = 1 << 16;
+
+template <typename T>
+void FillHeatmapPixels(const T* values, int rows, int cols, double scale_min, double scale_max, bool col_maj, ImU32* out) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotColormap cmap = gp.Style.Colormap;
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            const double val = (double)values[col_maj ? c * rows + r : r * cols + c];
+            const float t = ImClamp((float)ImRemap01(val, scale_min, scale_max),0.0f,1.0f);
+            out[r * cols + c] = gp.ColormapData.LerpTable(cmap, t);
+        }
+    }
+}
+#define INSTANTIATE_MACRO(T) template IMPLOT_API void FillHeatmapPixels<T>(const T* values, int rows, int cols, double scale_min, double scale_max, bool col_maj, ImU32* out);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+// Returns the current item's heatmap texture, refilling it through the callback only if its inputs changed
+template <typename T>
+ImTextureID GetHeatmapTexture(const T* values, int rows, int cols, double scale_min, double scale_max, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotItem& item = *gp.CurrentItem;
+    const int version = gp.NextItemData.DataVersion;
+    const ImGuiID key = HashArgs(0, values, rows, cols, scale_min, scale_max, col_maj, gp.Style.Colormap, version);
+    if (item.TexID == 0 || item.TexKey != key || version == 0) {
+        gp.HeatmapPixels.resize(rows * cols);
+        FillHeatmapPixels(values, rows, cols, scale_min, scale_max, col_maj, gp.HeatmapPixels.Data);
+        item.TexID  = gp.HeatmapTexCallback((const unsigned char*)gp.HeatmapPixels.Data, cols, rows, item.TexID, gp.HeatmapTexCallbackData);
+        item.TexKey = key;
+    }
+    return item.TexID;
+}
+
 template <typename T>
 void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
     ImPlotContext& gp = *GImPlot;
@@ -2427,54 +4561,99 @@ void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, d
     }
     const double yref = reverse_y ? bounds_max.y : bounds_min.y;
     const double ydir = reverse_y ? -1 : 1;
-    if (col_maj) {
-        GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
+    // a texture can't follow non-linear scales, which warp each cell differently
+    const bool linear = transformer.Tx.Scale == ImPlotScale_Linear && transformer.Ty.Scale == ImPlotScale_Linear;
+    if (gp.HeatmapTexCallback != nullptr && gp.CurrentItem != nullptr && linear) {
+        ImTextureID tex_id = GetHeatmapTexture(values, rows, cols, scale_min, scale_max, col_maj);
+        if (tex_id != 0) {
+            // row 0 of the texture is at yref
+            const ImVec2 p0 = transformer(bounds_min.x, yref);
+            const ImVec2 p1 = transformer(bounds_max.x, reverse_y ? bounds_min.y : bounds_max.y);
+            draw_list.AddImage(tex_id, p0, p1, ImVec2(0,0), ImVec2(1,1));
+        }
     }
     else {
-        GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
+        // only the cells within the axis ranges are visited
+        const HeatmapWindow window(rows, cols, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
+        if (col_maj) {
+            GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir, window);
+            RenderPrimitives1<RendererRectC>(getter);
+        }
+        else {
+            GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir, window);
+            RenderPrimitives1<RendererRectC>(getter);
+        }
     }
     // labels
     if (fmt != nullptr) {
         const double w = (bounds_max.x - bounds_min.x) / cols;
         const double h = (bounds_max.y - bounds_min.y) / rows;
-        const ImPlotPoint half_size(w*0.5,h*0.5);
-        int i = 0;
-        if (col_maj) {
-            for (int c = 0; c < cols; ++c) {
-                for (int r = 0; r < rows; ++r) {
-                    ImPlotPoint p;
-                    p.x = bounds_min.x + 0.5*w + c*w;
-                    p.y = yref + ydir * (0.5*h + r*h);
-                    ImVec2 px = transformer(p);
-                    char buff[32];
-                    ImFormatString(buff, 32, fmt, values[i]);
-                    ImVec2 size = ImGui::CalcTextSize(buff);
-                    double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
-                    ImVec4 color = SampleColormap((float)t);
-                    ImU32 col = CalcTextColor(color);
-                    draw_list.AddText(px - size * 0.5f, col, buff);
-                    i++;
-                }
+        const HeatmapWindow window(rows, cols, w, h, bounds_min.x, yref, ydir);
+        const float line_height = ImGui::GetTextLineHeight();
+        // cells are all the same size on linear axes, so one check rules out every label when zoomed out
+        if (linear && window.Rows() > 0 && window.Cols() > 0) {
+            const ImVec2 cell = transformer(bounds_min.x + w, yref + ydir * h) - transformer(bounds_min.x, yref);
+            if (ImAbs(cell.y) < line_height)
+                return;
+        }
+        // formatted labels are kept across frames while the item's data version is unchanged, unless the visible cells
+        // alone would overflow the cache. It's only reset when the visible cells don't fit in what's left of it.
+        ImPlotLabelCache* cache = nullptr;
+        const int visible = window.Rows() * window.Cols();
+        if (gp.CurrentItem != nullptr && gp.NextItemData.DataVersion != 0 && visible <= HEATMAP_LABEL_CACHE_SIZE) {
+            cache = &gp.CurrentItem->LabelCache;
+            ImGuiID key = HashArgs(0, values, rows, cols, col_maj, gp.NextItemData.DataVersion, ImGui::GetFont(), ImGui::GetFontSize());
+            key = ImHashStr(fmt, 0, key);
+            if (cache->Key != key || cache->Labels.Size + visible > HEATMAP_LABEL_CACHE_SIZE) {
+                cache->Reset();
+                cache->Key = key;
             }
         }
-        else {
-            for (int r = 0; r < rows; ++r) {
-                for (int c = 0; c < cols; ++c) {
-                    ImPlotPoint p;
-                    p.x = bounds_min.x + 0.5*w + c*w;
-                    p.y = yref + ydir * (0.5*h + r*h);
-                    ImVec2 px = transformer(p);
-                    char buff[32];
+        char buff[32];
+        // the label of 0 is about as short as a format gets, so narrower cells are skipped without formatting
+        ImFormatString(buff, 32, fmt, (T)0);
+        const float min_width = ImGui::CalcTextSize(buff).x;
+        for (int r = window.RowMin; r < window.RowMax; ++r) {
+            for (int c = window.ColMin; c < window.ColMax; ++c) {
+                const int i = col_maj ? c * rows + r : r * cols + c;
+                const ImVec2 p0 = transformer(bounds_min.x + c*w, yref + ydir * r*h);
+                const ImVec2 p1 = transformer(bounds_min.x + (c+1)*w, yref + ydir * (r+1)*h);
+                const ImVec2 cell(ImAbs(p1.x - p0.x), ImAbs(p1.y - p0.y));
+                if (cell.y < line_height || cell.x < min_width)
+                    continue;
+                const char* text;
+                ImVec2 size;
+                // labels are keyed in visit order (row major) so that new ones mostly append to the sorted storage
+                const ImGuiID label_id = (ImGuiID)(r * cols + c);
+                const int label_idx = cache != nullptr ? cache->Map.GetInt(label_id) - 1 : -1;
+                if (label_idx >= 0) {
+                    const ImPlotLabel& label = cache->Labels[label_idx];
+                    text = cache->GetText(label);
+                    size = label.Size;
+                }
+                else {
                     ImFormatString(buff, 32, fmt, values[i]);
-                    ImVec2 size = ImGui::CalcTextSize(buff);
-                    double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
-                    ImVec4 color = SampleColormap((float)t);
-                    ImU32 col = CalcTextColor(color);
-                    draw_list.AddText(px - size * 0.5f, col, buff);
-                    i++;
+                    text = buff;
+                    size = ImGui::CalcTextSize(buff);
+                    if (cache != nullptr && cache->Labels.Size < HEATMAP_LABEL_CACHE_SIZE) {
+                        ImPlotLabel label;
+                        label.TextOffset = cache->TextBuffer.size();
+                        label.Size = size;
+                        cache->TextBuffer.append(buff, buff + strlen(buff) + 1);
+                        cache->Map.SetInt(label_id, cache->Labels.Size + 1);
+                        cache->Labels.push_back(label);
+                    }
                 }
+                if (size.x > cell.x)
+                    continue;
+                ImPlotPoint p;
+                p.x = bounds_min.x + 0.5*w + c*w;
+                p.y = yref + ydir * (0.5*h + r*h);
+                ImVec2 px = transformer(p);
+                double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
+                ImVec4 color = SampleColormap((float)t);
+                ImU32 col = CalcTextColor(color);
+                draw_list.AddText(px - size * 0.5f, col, text);
             }
         }
     }
@@ -2498,58 +4677,130 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
 //-----------------------------------------------------------------------------
-// [SECTION] PlotHistogram
+// [SECTION] Binning
 //-----------------------------------------------------------------------------
 
-template <typename T>
-double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
+// Binners map each of their Count values to one of Slots counters with Slot(i). Bins are uniform, so a value's bin
+// is found with a reciprocal multiply, and out-of-range values go to extra slots after the bins instead of branching.
 
-    const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative);
-    const bool density    = ImHasFlag(flags, ImPlotHistogramFlags_Density);
-    const bool outliers   = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
+/// Maps a value to a uniform bin of [Min,Max], clamping values outside of it to the first or last bin
+struct BinAxis {
+    BinAxis(const ImPlotRange& range, int bins, double width) :
+        Min(range.Min),
+        Max(range.Max),
+        InvWidth(1.0 / width),
+        Last(bins - 1)
+    { }
+    IMPLOT_INLINE int Bin(double v) const {
+        const double t = (v - Min) * InvWidth;
+        return t > 0 ? (t < Last ? (int)t : Last) : 0;
+    }
+    IMPLOT_INLINE bool Contains(double v) const {
+        return v >= Min && v <= Max;
+    }
+    const double Min, Max, InvWidth;
+    const int Last;
+};
 
-    if (count <= 0 || bins == 0)
-        return 0;
+/// Bins values into [0,bins), followed by a slot for values below the range and one for values above it (or NaN)
+template <typename T>
+struct Binner1 {
+    Binner1(const T* values, int count, const ImPlotRange& range, int bins, double width) :
+        Values(values),
+        Count(count),
+        Slots(bins + 2),
+        Bins(bins),
+        Axis(range, bins, width)
+    { }
+    IMPLOT_INLINE int Slot(int i) const {
+        const double v = (double)Values[i];
+        const int b = Axis.Bin(v);
+        return v < Axis.Min ? Bins : Axis.Contains(v) ? b : Bins + 1;
+    }
+    const T* const Values;
+    const int Count, Slots, Bins;
+    const BinAxis Axis;
+};
 
-    if (range.Min == 0 && range.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(values, count, &Min, &Max);
-        range.Min = (double)Min;
-        range.Max = (double)Max;
+/// Bins points into [0,x_bins*y_bins) (row major), followed by a slot for points outside of the range
+template <typename T>
+struct Binner2 {
+    Binner2(const T* xs, const T* ys, int count, const ImPlotRect& range, int x_bins, int y_bins, double width, double height) :
+        Xs(xs),
+        Ys(ys),
+        Count(count),
+        Slots(x_bins * y_bins + 1),
+        XBins(x_bins),
+        AxisX(range.X, x_bins, width),
+        AxisY(range.Y, y_bins, height)
+    { }
+    IMPLOT_INLINE int Slot(int i) const {
+        const double x = (double)Xs[i];
+        const double y = (double)Ys[i];
+        const int b = AxisY.Bin(y) * XBins + AxisX.Bin(x);
+        return AxisX.Contains(x) && AxisY.Contains(y) ? b : Slots - 1;
     }
+    const T* const Xs;
+    const T* const Ys;
+    const int Count, Slots, XBins;
+    const BinAxis AxisX, AxisY;
+};
 
-    double width;
-    if (bins < 0)
-        CalculateBins(values, count, bins, range, bins, width);
-    else
-        width = range.Size() / bins;
+// Adds the slots of values [first,last) to counts. Slots are computed a block at a time, in a loop without branches
+// so that it vectorizes, and then counted.
+template <typename _Binner>
+void BinRange(const _Binner& binner, int first, int last, int* counts) {
+    int slots[BLOCK_SIZE];
+    for (int i = first; i < last; i += BLOCK_SIZE) {
+        const int n = ImMin(BLOCK_SIZE, last - i);
+        for (int j = 0; j < n; ++j)
+            slots[j] = binner.Slot(i + j);
+        for (int j = 0; j < n; ++j)
+            counts[slots[j]]++;
+    }
+}
 
-    ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_centers = gp.TempDouble1;
-    ImVector<double>& bin_counts  = gp.TempDouble2;
-    bin_centers.resize(bins);
-    bin_counts.resize(bins);
-    int below = 0;
+/// Counts each task's range into its own partial histogram of Slots counters
+template <typename _Binner>
+struct BinPartials {
+    BinPartials(const _Binner& binner, int* counts) : Binner(binner), Counts(counts) { }
+    void operator()(int task_idx, int first, int last) const { BinRange(Binner, first, last, Counts + task_idx * Binner.Slots); }
+    const _Binner& Binner;
+    int* const     Counts;
+};
 
-    for (int b = 0; b < bins; ++b) {
-        bin_centers[b] = range.Min + b * width + width * 0.5;
-        bin_counts[b] = 0;
+// Counts the values of a binner into out (Slots doubles), as partial histograms merged at the end when split
+// across tasks (see RunRangeTasks)
+template <typename _Binner>
+void BinValues(const _Binner& binner, double* out) {
+    ImPlotContext& gp = *GImPlot;
+    // each task must count at least as many values as there are slots to merge
+    const int tasks = GetTaskCount(binner.Count, ImMax((int)TASK_MIN_PRIMS, binner.Slots));
+    ImVector<int>& counts = gp.TempInt1;
+    counts.resize(tasks * binner.Slots);
+    memset(counts.Data, 0, counts.Size * sizeof(int));
+    RunRangeTasks(BinPartials<_Binner>(binner, counts.Data), binner.Count, tasks);
+    for (int s = 0; s < binner.Slots; ++s) {
+        int n = 0;
+        for (int t = 0; t < tasks; ++t)
+            n += counts[t * binner.Slots + s];
+        out[s] = (double)n;
     }
-    int counted = 0;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotHistogram
+//-----------------------------------------------------------------------------
+
+// Applies the cumulative and density flags to the counts of #bins bins, plots them as bars, and returns the tallest.
+// #below values fell below the first bin, #counted within the bins, and #count were binned in total.
+static double PlotHistogramBins(const char* label_id, double* bin_centers, double* bin_counts, int bins, double width, double below, double counted, double count, double bar_scale, ImPlotHistogramFlags flags) {
+    const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative);
+    const bool density    = ImHasFlag(flags, ImPlotHistogramFlags_Density);
+    const bool outliers   = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
     double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        double val = (double)values[i];
-        if (range.Contains(val)) {
-            const int b = ImClamp((int)((val - range.Min) / width), 0, bins - 1);
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
-        else if (val < range.Min) {
-            below++;
-        }
-    }
+    for (int b = 0; b < bins; ++b)
+        max_count = ImMax(max_count, bin_counts[b]);
     if (cumulative && density) {
         if (outliers)
             bin_counts[0] += below;
@@ -2574,15 +4825,129 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
         max_count *= scale;
     }
     if (ImHasFlag(flags, ImPlotHistogramFlags_Horizontal))
-        PlotBars(label_id, &bin_counts.Data[0], &bin_centers.Data[0], bins, bar_scale*width, ImPlotBarsFlags_Horizontal);
+        PlotBars(label_id, bin_counts, bin_centers, bins, bar_scale*width, ImPlotBarsFlags_Horizontal);
     else
-        PlotBars(label_id, &bin_centers.Data[0], &bin_counts.Data[0], bins, bar_scale*width);
+        PlotBars(label_id, bin_centers, bin_counts, bins, bar_scale*width);
     return max_count;
 }
+
+template <typename T>
+double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
+
+    if (count <= 0 || bins == 0)
+        return 0;
+
+    if (range.Min == 0 && range.Max == 0) {
+        T Min, Max;
+        ImMinMaxArray(values, count, &Min, &Max);
+        range.Min = (double)Min;
+        range.Max = (double)Max;
+    }
+
+    double width;
+    if (bins < 0)
+        CalculateBins(values, count, bins, range, bins, width);
+    else
+        width = range.Size() / bins;
+
+    ImPlotContext& gp = *GImPlot;
+    ImVector<double>& bin_centers = gp.TempDouble1;
+    ImVector<double>& bin_counts  = gp.TempDouble2;
+    bin_centers.resize(bins);
+    bin_counts.resize(bins + 2);
+
+    for (int b = 0; b < bins; ++b)
+        bin_centers[b] = range.Min + b * width + width * 0.5;
+    BinValues(Binner1<T>(values, count, range, bins, width), bin_counts.Data);
+    // the binner's below and above slots follow the bins
+    const int below   = (int)bin_counts[bins];
+    const int counted = count - below - (int)bin_counts[bins + 1];
+    return PlotHistogramBins(label_id, bin_centers.Data, bin_counts.Data, bins, width, below, counted, count, bar_scale, flags);
+}
 #define INSTANTIATE_MACRO(T) template IMPLOT_API double PlotHistogram<T>(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
+// Grows the power of two bin width of an auto ranging histogram until its bins span [lo,hi], merging pairs of bins
+static void WidenHistogram(ImPlotHistogramState& state, double lo, double hi) {
+    const int bins = state.Counts.Size;
+    if (state.Width == 0) {
+        // smallest power of two that spans the first values
+        const double span = hi > lo ? hi - lo : lo != 0 ? ImAbs(lo) : 1.0;
+        int exp;
+        frexp(span / bins, &exp);
+        state.Width = ldexp(1.0, exp);
+        state.Min   = floor(lo / state.Width) * state.Width;
+    }
+    while (lo < state.Min || hi > state.Max()) {
+        const double width = state.Width * 2;
+        const double min   = floor(state.Min / width) * width;
+        // the old first bin is either the first or second half of a new bin
+        const int shift = (int)((state.Min - min) / state.Width);
+        for (int b = 0; b < bins; ++b) {
+            const double n = state.Counts[b];
+            state.Counts[b] = 0;
+            state.Counts[(b + shift) / 2] += n;
+        }
+        state.Width = width;
+        state.Min   = min;
+    }
+}
+
+template <typename T>
+void AddHistogramValues(ImPlotHistogramState& state, const T* values, int count) {
+    const int bins = state.Counts.Size;
+    if (count <= 0 || bins == 0)
+        return;
+    if (state.AutoRange) {
+        // infinities can't be binned, and are left to the below and above counts
+        double lo = DBL_MAX, hi = -DBL_MAX;
+        for (int i = 0; i < count; ++i) {
+            const double v = (double)values[i];
+            if (ImNanOrInf(v))
+                continue;
+            lo = ImMin(lo, v);
+            hi = ImMax(hi, v);
+        }
+        if (lo <= hi)
+            WidenHistogram(state, lo, hi);
+        if (state.Width == 0) {
+            state.Above += count;
+            state.Total += count;
+            return;
+        }
+    }
+    ImPlotContext& gp = *GImPlot;
+    ImVector<double>& bin_counts = gp.TempDouble1;
+    bin_counts.resize(bins + 2);
+    BinValues(Binner1<T>(values, count, ImPlotRange(state.Min, state.Max()), bins, state.Width), bin_counts.Data);
+    for (int b = 0; b < bins; ++b)
+        state.Counts[b] += bin_counts[b];
+    state.Below += bin_counts[bins];
+    state.Above += bin_counts[bins + 1];
+    state.Total += count;
+}
+#define INSTANTIATE_MACRO(T) template IMPLOT_API void AddHistogramValues<T>(ImPlotHistogramState& state, const T* values, int count);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+double PlotHistogram(const char* label_id, const ImPlotHistogramState& state, double bar_scale, ImPlotHistogramFlags flags) {
+    const int bins = state.Counts.Size;
+    if (bins == 0 || state.Width == 0)
+        return 0;
+    ImPlotContext& gp = *GImPlot;
+    ImVector<double>& bin_centers = gp.TempDouble1;
+    ImVector<double>& bin_counts  = gp.TempDouble2;
+    bin_centers.resize(bins);
+    bin_counts.resize(bins);
+    for (int b = 0; b < bins; ++b) {
+        bin_centers[b] = state.Min + b * state.Width + state.Width * 0.5;
+        bin_counts[b]  = state.Counts[b];
+    }
+    const double counted = state.Total - state.Below - state.Above;
+    return PlotHistogramBins(label_id, bin_centers.Data, bin_counts.Data, bins, state.Width, state.Below, counted, state.Total, bar_scale, flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotHistogram2D
 //-----------------------------------------------------------------------------
@@ -2625,24 +4990,14 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
 
     ImPlotContext& gp = *GImPlot;
     ImVector<double>& bin_counts = gp.TempDouble1;
-    bin_counts.resize(bins);
-
-    for (int b = 0; b < bins; ++b)
-        bin_counts[b] = 0;
+    bin_counts.resize(bins + 1);
 
-    int counted = 0;
+    BinValues(Binner2<T>(xs, ys, count, range, x_bins, y_bins, width, height), bin_counts.Data);
+    // the binner's outside slot follows the bins
+    const int counted = count - (int)bin_counts[bins];
     double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        if (range.Contains((double)xs[i], (double)ys[i])) {
-            const int xb = ImClamp( (int)((double)(xs[i] - range.X.Min) / width)  , 0, x_bins - 1);
-            const int yb = ImClamp( (int)((double)(ys[i] - range.Y.Min) / height) , 0, y_bins - 1);
-            const int b  = yb * x_bins + xb;
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
-    }
+    for (int b = 0; b < bins; ++b)
+        max_count = ImMax(max_count, bin_counts[b]);
     if (density) {
         double scale = 1.0 / ((outliers ? count : counted) * width * height);
         for (int b = 0; b < bins; ++b)
@@ -2671,66 +5026,81 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 // TODO: Make this behave like all the other plot types (.e. not fixed in y axis)
 
-template <typename Getter>
-void PlotDigitalEx(const char* label_id, Getter getter, ImPlotDigitalFlags flags) {
-    if (BeginItem(label_id, flags, ImPlotCol_Fill)) {
+// Returns the highest state of a digital item over all of its points, not just the visible ones, so that the items
+// stacked above it don't move while panning, or -HUGE_VAL if it has none. This scans every point, so items with a data
+// version (see SetNextItemDataVersion) only rescan when it or the getter changes.
+template <typename _Getter>
+double GetDigitalMax(const _Getter& getter) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotItem& item  = *gp.CurrentItem;
+    const int version = gp.NextItemData.DataVersion;
+    ImPlotDigitalCache* cache = nullptr;
+    ImGuiID key = 0;
+    if (version != 0) {
+        if (item.DigitalMaxesUsed == item.DigitalMaxes.Size)
+            item.DigitalMaxes.push_back(ImPlotDigitalCache());
+        cache = &item.DigitalMaxes[item.DigitalMaxesUsed++];
+        key   = HashArgs(getter.Hash(0), version);
+        key   = key != 0 ? key : 1;
+        if (cache->Key == key)
+            return cache->MaxY;
+    }
+    // the last point only ends the previous state
+    double max_y = -HUGE_VAL;
+    ImPlotPoint points[BLOCK_SIZE];
+    for (int b = 0; b < getter.Count - 1; b += BLOCK_SIZE) {
+        const int n = ImMin(BLOCK_SIZE, getter.Count - 1 - b);
+        getter.GetBlock(b, n, points);
+        for (int i = 0; i < n; ++i) {
+            const double y = points[i].y;
+            max_y = ImNanOrInf(y) ? max_y : ImMax(max_y, y);
+        }
+    }
+    if (cache != nullptr) {
+        cache->Key  = key;
+        cache->MaxY = max_y;
+    }
+    return max_y;
+}
+
+// Renders the states of a digital item stacked above the previous ones, #y_max being the item's highest state.
+// Returns how much the item takes up in pixels.
+template <typename _Getter>
+int RenderDigitalItem(const _Getter& getter, double y_max) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    const ImPlotNextItemData& s = GetItemData();
+    const float y_base = plot.Axes[plot.CurrentY].PixelMin - (float)gp.DigitalPlotOffset;
+    const ImU32 col    = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+    RenderPrimitivesEx(RendererDigital<_Getter>(getter, col, y_base, s.LineWeight, s.DigitalBitHeight, plot.PlotRect.Min.x, plot.PlotRect.Max.x), *GetPlotDrawList(), plot.PlotRect);
+    return (int)(ImMax(s.DigitalBitHeight, s.DigitalBitHeight * (float)ImMax(0.0, y_max)) + s.DigitalBitGap);
+}
+
+template <typename _Getter>
+void PlotDigitalEx(const char* label_id, const _Getter& getter, ImPlotDigitalFlags flags) {
+    if (BeginItemEx(label_id, FitterX<_Getter>(getter), flags, ImPlotCol_Fill)) {
         ImPlotContext& gp = *GImPlot;
-        ImDrawList& draw_list = *GetPlotDrawList();
         const ImPlotNextItemData& s = GetItemData();
         if (getter.Count > 1 && s.RenderFill) {
-            ImPlotPlot& plot   = *gp.CurrentPlot;
-            ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
-            ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
-
-            int pixYMax = 0;
-            ImPlotPoint itemData1 = getter(0);
-            for (int i = 0; i < getter.Count; ++i) {
-                ImPlotPoint itemData2 = getter(i);
-                if (ImNanOrInf(itemData1.y)) {
-                    itemData1 = itemData2;
-                    continue;
+            // the item's height follows the highest state it has
+            const double max_y = GetDigitalMax(getter);
+            int height = 0;
+            if (max_y != -HUGE_VAL) {
+                if (ImHasFlag(flags, ImPlotItemFlags_SortedX)) {
+                    int first, last;
+                    GetVisibleRangeX(getter, first, last);
+                    height = RenderDigitalItem(GetterSlice<_Getter>(getter, first, last - first + 1), max_y);
                 }
-                if (ImNanOrInf(itemData2.y)) itemData2.y = ImConstrainNan(ImConstrainInf(itemData2.y));
-                int pixY_0 = (int)(s.LineWeight);
-                itemData1.y = ImMax(0.0, itemData1.y);
-                float pixY_1_float = s.DigitalBitHeight * (float)itemData1.y;
-                int pixY_1 = (int)(pixY_1_float); //allow only positive values
-                int pixY_chPosOffset = (int)(ImMax(s.DigitalBitHeight, pixY_1_float) + s.DigitalBitGap);
-                pixYMax = ImMax(pixYMax, pixY_chPosOffset);
-                ImVec2 pMin = PlotToPixels(itemData1,IMPLOT_AUTO,IMPLOT_AUTO);
-                ImVec2 pMax = PlotToPixels(itemData2,IMPLOT_AUTO,IMPLOT_AUTO);
-                int pixY_Offset = 0; //20 pixel from bottom due to mouse cursor label
-                pMin.y = (y_axis.PixelMin) + ((-gp.DigitalPlotOffset)                   - pixY_Offset);
-                pMax.y = (y_axis.PixelMin) + ((-gp.DigitalPlotOffset) - pixY_0 - pixY_1 - pixY_Offset);
-                //plot only one rectangle for same digital state
-                while (((i+2) < getter.Count) && (itemData1.y == itemData2.y)) {
-                    const int in = (i + 1);
-                    itemData2 = getter(in);
-                    if (ImNanOrInf(itemData2.y)) break;
-                    pMax.x = PlotToPixels(itemData2,IMPLOT_AUTO,IMPLOT_AUTO).x;
-                    i++;
-                }
-                //do not extend plot outside plot range
-                if (pMin.x < x_axis.PixelMin) pMin.x = x_axis.PixelMin;
-                if (pMax.x < x_axis.PixelMin) pMax.x = x_axis.PixelMin;
-                if (pMin.x > x_axis.PixelMax) pMin.x = x_axis.PixelMax - 1; //fix issue related to https://github.com/ocornut/imgui/issues/3976
-                if (pMax.x > x_axis.PixelMax) pMax.x = x_axis.PixelMax - 1; //fix issue related to https://github.com/ocornut/imgui/issues/3976
-                //plot a rectangle that extends up to x2 with y1 height
-                if ((pMax.x > pMin.x) && (gp.CurrentPlot->PlotRect.Contains(pMin) || gp.CurrentPlot->PlotRect.Contains(pMax))) {
-                    // ImVec4 colAlpha = item->Color;
-                    // colAlpha.w = item->Highlight ? 1.0f : 0.9f;
-                    draw_list.AddRectFilled(pMin, pMax, ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]));
-                }
-                itemData1 = itemData2;
+                else
+                    height = RenderDigitalItem(getter, max_y);
             }
             gp.DigitalPlotItemCnt++;
-            gp.DigitalPlotOffset += pixYMax;
+            gp.DigitalPlotOffset += height;
         }
         EndItem();
     }
 }
 
-
 template <typename T>
 void PlotDigital(const char* label_id, const T* xs, const T* ys, int count, ImPlotDigitalFlags flags, int offset, int stride) {
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys,count,offset,stride),count);